@@ -1,5 +1,7 @@
 #include "plugin.hpp"
 
+using simd::float_4;
+
 struct ADGenerator : Module {
     enum ParamId {
         ATK_ALL_PARAM,
@@ -51,44 +53,78 @@ struct ADGenerator : Module {
     float bpfCutoffs[3] = {200.0f, 1000.0f, 5000.0f};
     float bpfGains[3] = {3.0f, 3.0f, 3.0f};
     
-    struct BandPassFilter {
-        float lowpass1 = 0.0f, highpass1 = 0.0f, bandpass1 = 0.0f;
-        float lowpass2 = 0.0f, highpass2 = 0.0f, bandpass2 = 0.0f;
-        float lowpass3 = 0.0f, highpass3 = 0.0f, bandpass3 = 0.0f;
-        float lowpass4 = 0.0f, highpass4 = 0.0f, bandpass4 = 0.0f;
+    // The three track filters as one float_4 bank, lane i = track i. Each
+    // lane is four cascaded Chamberlin band-pass stages; the frequency
+    // coefficient is recomputed only when a cutoff or the sample rate moves.
+    struct BandPassBank {
+        static constexpr int STAGES = 4;
+
+        float_4 lowpass[STAGES];
+        float_4 bandpass[STAGES];
+        float_4 coeff = 0.0f;
+        float cutoffs[3] = {-1.0f, -1.0f, -1.0f};
+        float sampleRate = 0.0f;
+
+        BandPassBank() {
+            reset();
+        }
 
         void reset() {
-            lowpass1 = highpass1 = bandpass1 = 0.0f;
-            lowpass2 = highpass2 = bandpass2 = 0.0f;
-            lowpass3 = highpass3 = bandpass3 = 0.0f;
-            lowpass4 = highpass4 = bandpass4 = 0.0f;
+            for (int s = 0; s < STAGES; ++s) {
+                lowpass[s] = 0.0f;
+                bandpass[s] = 0.0f;
+            }
         }
 
-        float process(float input, float cutoff, float sampleRate) {
-            float f = 2.0f * std::sin(M_PI * cutoff / sampleRate);
-            f = clamp(f, 0.0f, 1.0f);
+        void setCutoffs(const float* newCutoffs, float newSampleRate) {
+            bool rateChanged = newSampleRate != sampleRate;
+            sampleRate = newSampleRate;
+            for (int i = 0; i < 3; ++i) {
+                if (!rateChanged && newCutoffs[i] == cutoffs[i])
+                    continue;
+                cutoffs[i] = newCutoffs[i];
+                float f = 2.0f * std::sin(M_PI * cutoffs[i] / sampleRate);
+                coeff[i] = clamp(f, 0.0f, 1.0f);
+            }
+        }
 
-            lowpass1 += f * (input - lowpass1);
-            highpass1 = input - lowpass1;
-            bandpass1 += f * (highpass1 - bandpass1);
+        float_4 process(float_4 input) {
+            for (int s = 0; s < STAGES; ++s) {
+                lowpass[s] += coeff * (input - lowpass[s]);
+                float_4 highpass = input - lowpass[s];
+                bandpass[s] += coeff * (highpass - bandpass[s]);
+                input = bandpass[s];
+            }
+            return input;
+        }
+    };
 
-            lowpass2 += f * (bandpass1 - lowpass2);
-            highpass2 = bandpass1 - lowpass2;
-            bandpass2 += f * (highpass2 - bandpass2);
+    BandPassBank bpfBank;
 
-            lowpass3 += f * (bandpass2 - lowpass3);
-            highpass3 = bandpass2 - lowpass3;
-            bandpass3 += f * (highpass3 - bandpass3);
+    // Knob position to stage seconds, 10^((p - 0.5) * 6), sampled so the
+    // envelopes never call pow(). Linear interpolation between the 257
+    // points stays within 0.04% of the exact curve.
+    struct KnobTimeTable {
+        static constexpr int SIZE = 256;
+        float seconds[SIZE + 1];
 
-            lowpass4 += f * (bandpass3 - lowpass4);
-            highpass4 = bandpass3 - lowpass4;
-            bandpass4 += f * (highpass4 - bandpass4);
+        KnobTimeTable() {
+            for (int i = 0; i <= SIZE; ++i) {
+                seconds[i] = std::pow(10.0f, ((float)i / SIZE - 0.5f) * 6.0f);
+            }
+        }
 
-            return bandpass4;
+        float lookup(float knob) const {
+            float x = clamp(knob, 0.0f, 1.0f) * SIZE;
+            int i = std::min((int)x, SIZE - 1);
+            return seconds[i] + (seconds[i + 1] - seconds[i]) * (x - i);
         }
     };
-    
-    BandPassFilter bpfFilters[3];
+
+    static const KnobTimeTable& knobTimes() {
+        static const KnobTimeTable table;
+        return table;
+    }
 
     struct ADEnvelope {
         enum Phase {
@@ -99,29 +135,32 @@ struct ADGenerator : Module {
         
         Phase phase = IDLE;
         float triggerOutput = 0.0f;
-        float followerOutput = 0.0f;
         float attackTime = 0.01f;
         float decayTime = 1.0f;
         float phaseTime = 0.0f;
         float curve = 0.0f;
         float followerState = 0.0f;
-        float attackCoeff = 0.0f;
+        float attackCoeff = 0.0f;   // follower coefficients, already curved
         float releaseCoeff = 0.0f;
         
         dsp::SchmittTrigger trigger;
         
         Phase oldPhase = IDLE;
         float oldOutput = 0.0f;
-        float oldAttackTime = 0.01f;
-        float oldDecayTime = 1.0f;
         float oldPhaseTime = 0.0f;
-        float oldCurve = 0.0f;
         dsp::SchmittTrigger oldTrigger;
+
+        // Inputs of the cached times and coefficients
+        float lastAttack = -1.0f;
+        float lastDecay = -1.0f;
+        float lastAtkAll = 0.0f;
+        float lastDecAll = 0.0f;
+        float lastCurve = 0.0f;
+        float lastSampleTime = 0.0f;
         
         void reset() {
             phase = IDLE;
             triggerOutput = 0.0f;
-            followerOutput = 0.0f;
             followerState = 0.0f;
             phaseTime = 0.0f;
             oldPhase = IDLE;
@@ -146,27 +185,36 @@ struct ADGenerator : Module {
             
             return (x - k * x) / denominator;
         }
+
+        // Stage times and follower coefficients, recomputed only when one
+        // of their inputs changes
+        void setTimes(float sampleTime, float attack, float decay, float curveParam, float atkAll, float decAll) {
+            if (attack == lastAttack && decay == lastDecay && curveParam == lastCurve
+                && atkAll == lastAtkAll && decAll == lastDecAll && sampleTime == lastSampleTime) {
+                return;
+            }
+            lastAttack = attack;
+            lastDecay = decay;
+            lastCurve = curveParam;
+            lastAtkAll = atkAll;
+            lastDecAll = decAll;
+            lastSampleTime = sampleTime;
+
+            attackTime = std::max(0.001f, knobTimes().lookup(attack) + atkAll * 0.5f);
+            decayTime = std::max(0.001f, knobTimes().lookup(decay) + decAll * 0.5f);
+            curve = curveParam;
+
+            float attackRate = 1.0f - std::exp(-sampleTime / std::max(0.0005f, attackTime * 0.1f));
+            float releaseRate = 1.0f - std::exp(-sampleTime / std::max(0.001f, decayTime * 0.5f));
+            attackCoeff = clamp(applyCurve(clamp(attackRate, 0.0f, 1.0f), curve), 0.0f, 1.0f);
+            releaseCoeff = clamp(applyCurve(clamp(releaseRate, 0.0f, 1.0f), curve), 0.0f, 1.0f);
+        }
         
-        float processEnvelopeFollower(float triggerVoltage, float sampleTime, float attackTime, float releaseTime, float curve) {
-            attackCoeff = 1.0f - std::exp(-sampleTime / std::max(0.0005f, attackTime * 0.1f));
-            releaseCoeff = 1.0f - std::exp(-sampleTime / std::max(0.001f, releaseTime * 0.5f));
-            
-            attackCoeff = clamp(attackCoeff, 0.0f, 1.0f);
-            releaseCoeff = clamp(releaseCoeff, 0.0f, 1.0f);
-            
+        float processEnvelopeFollower(float triggerVoltage) {
             float rectified = std::abs(triggerVoltage) / 10.0f;
             rectified = clamp(rectified, 0.0f, 1.0f);
             
-            float targetCoeff;
-            if (rectified > followerState) {
-                float progress = attackCoeff;
-                targetCoeff = applyCurve(progress, curve);
-            } else {
-                float progress = releaseCoeff;
-                targetCoeff = applyCurve(progress, curve);
-            }
-            
-            targetCoeff = clamp(targetCoeff, 0.0f, 1.0f);
+            float targetCoeff = (rectified > followerState) ? attackCoeff : releaseCoeff;
             
             followerState += (rectified - followerState) * targetCoeff;
             followerState = clamp(followerState, 0.0f, 1.0f);
@@ -174,7 +222,7 @@ struct ADGenerator : Module {
             return followerState;
         }
         
-        float processTriggerEnvelope(float triggerVoltage, float sampleTime, float attack, float decay, float curve) {
+        float processTriggerEnvelope(float triggerVoltage, float sampleTime) {
             bool isHighVoltage = (std::abs(triggerVoltage) > 9.5f);
             
             if (phase == IDLE && isHighVoltage && trigger.process(triggerVoltage)) {
@@ -189,24 +237,24 @@ struct ADGenerator : Module {
                     
                 case ATTACK:
                     phaseTime += sampleTime;
-                    if (phaseTime >= attack) {
+                    if (phaseTime >= attackTime) {
                         phase = DECAY;
                         phaseTime = 0.0f;
                         triggerOutput = 1.0f;
                     } else {
-                        float t = phaseTime / attack;
+                        float t = phaseTime / attackTime;
                         triggerOutput = applyCurve(t, curve);
                     }
                     break;
                     
                 case DECAY:
                     phaseTime += sampleTime;
-                    if (phaseTime >= decay) {
+                    if (phaseTime >= decayTime) {
                         triggerOutput = 0.0f;
                         phase = IDLE;
                         phaseTime = 0.0f;
                     } else {
-                        float t = phaseTime / decay;
+                        float t = phaseTime / decayTime;
                         triggerOutput = 1.0f - applyCurve(t, curve);
                     }
                     break;
@@ -215,18 +263,7 @@ struct ADGenerator : Module {
             return clamp(triggerOutput, 0.0f, 1.0f);
         }
         
-        float processOldVersion(float sampleTime, float triggerVoltage, float attack, float decay, float curveParam, float atkAll, float decAll) {
-            float atkOffset = atkAll * 0.5f;
-            float decOffset = decAll * 0.5f;
-            
-            oldAttackTime = std::pow(10.0f, (attack - 0.5f) * 6.0f) + atkOffset;
-            oldDecayTime = std::pow(10.0f, (decay - 0.5f) * 6.0f) + decOffset;
-            
-            oldAttackTime = std::max(0.001f, oldAttackTime);
-            oldDecayTime = std::max(0.001f, oldDecayTime);
-            
-            oldCurve = curveParam;
-            
+        float processOldVersion(float sampleTime, float triggerVoltage) {
             if (oldPhase == IDLE && oldTrigger.process(triggerVoltage)) {
                 oldPhase = ATTACK;
                 oldPhaseTime = 0.0f;
@@ -239,25 +276,25 @@ struct ADGenerator : Module {
                     
                 case ATTACK:
                     oldPhaseTime += sampleTime;
-                    if (oldPhaseTime >= oldAttackTime) {
+                    if (oldPhaseTime >= attackTime) {
                         oldPhase = DECAY;
                         oldPhaseTime = 0.0f;
                         oldOutput = 1.0f;
                     } else {
-                        float t = oldPhaseTime / oldAttackTime;
-                        oldOutput = applyCurve(t, oldCurve);
+                        float t = oldPhaseTime / attackTime;
+                        oldOutput = applyCurve(t, curve);
                     }
                     break;
                     
                 case DECAY:
                     oldPhaseTime += sampleTime;
-                    if (oldPhaseTime >= oldDecayTime) {
+                    if (oldPhaseTime >= decayTime) {
                         oldOutput = 0.0f;
                         oldPhase = IDLE;
                         oldPhaseTime = 0.0f;
                     } else {
-                        float t = oldPhaseTime / oldDecayTime;
-                        oldOutput = 1.0f - applyCurve(t, oldCurve);
+                        float t = oldPhaseTime / decayTime;
+                        oldOutput = 1.0f - applyCurve(t, curve);
                     }
                     break;
             }
@@ -267,22 +304,13 @@ struct ADGenerator : Module {
         }
         
         float process(float sampleTime, float triggerVoltage, float attack, float decay, float curveParam, float atkAll, float decAll, bool useBPF) {
+            setTimes(sampleTime, attack, decay, curveParam, atkAll, decAll);
+
             if (!useBPF) {
-                return processOldVersion(sampleTime, triggerVoltage, attack, decay, curveParam, atkAll, decAll);
+                return processOldVersion(sampleTime, triggerVoltage);
             } else {
-                float atkOffset = atkAll * 0.5f;
-                float decOffset = decAll * 0.5f;
-                
-                attackTime = std::pow(10.0f, (attack - 0.5f) * 6.0f) + atkOffset;
-                decayTime = std::pow(10.0f, (decay - 0.5f) * 6.0f) + decOffset;
-                
-                attackTime = std::max(0.001f, attackTime);
-                decayTime = std::max(0.001f, decayTime);
-                
-                curve = curveParam;
-                
-                float triggerEnv = processTriggerEnvelope(triggerVoltage, sampleTime, attackTime, decayTime, curve);
-                float followerEnv = processEnvelopeFollower(triggerVoltage, sampleTime, attackTime, decayTime, curve);
+                float triggerEnv = processTriggerEnvelope(triggerVoltage, sampleTime);
+                float followerEnv = processEnvelopeFollower(triggerVoltage);
                 
                 float output = std::max(triggerEnv, followerEnv);
                 
@@ -339,8 +367,8 @@ struct ADGenerator : Module {
     void onReset() override {
         for (int i = 0; i < 3; ++i) {
             envelopes[i].reset();
-            bpfFilters[i].reset();
         }
+        bpfBank.reset();
     }
 
     json_t* dataToJson() override {
@@ -431,11 +459,20 @@ struct ADGenerator : Module {
             inputSignals[2] = inputs[TRACK3_TRIG_INPUT].getVoltage();
         }
         
-        for (int i = 0; i < 3; ++i) {
-            float processedSignal = inputSignals[i];
-            if (bpfEnabled[i]) {
-                processedSignal = bpfFilters[i].process(inputSignals[i], bpfCutoffs[i], args.sampleRate);
+        // One bank pass filters every enabled track
+        float processedSignals[3] = {inputSignals[0], inputSignals[1], inputSignals[2]};
+        if (bpfEnabled[0] || bpfEnabled[1] || bpfEnabled[2]) {
+            bpfBank.setCutoffs(bpfCutoffs, args.sampleRate);
+            float_4 filtered = bpfBank.process(float_4(inputSignals[0], inputSignals[1], inputSignals[2], 0.0f));
+            for (int i = 0; i < 3; ++i) {
+                if (bpfEnabled[i]) {
+                    processedSignals[i] = filtered[i];
+                }
             }
+        }
+        
+        for (int i = 0; i < 3; ++i) {
+            float processedSignal = processedSignals[i];
             
             float attackParam = params[TRACK1_ATTACK_PARAM + i * 6].getValue();
             float decayParam = params[TRACK1_DECAY_PARAM + i * 6].getValue();
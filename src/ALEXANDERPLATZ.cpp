@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "PolyBus.hpp"
 #include <cmath>
 
 // Biquad Peak EQ Filter (Audio EQ Cookbook)
@@ -75,6 +76,10 @@ struct ALEXANDERPLATZ : Module {
     float lastEqGains[ALEX_EQ_BANDS] = {};
     float lastSampleRate = 0.f;
 
+    // Sum the mixers to the left over the expander bus instead of the chain cables
+    bool expanderBus = false;
+    polybus::BusFrame busFrames[2];
+
     ALEXANDERPLATZ() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
         for (int t = 0; t < ALEX_TRACKS; t++) {
@@ -96,6 +101,8 @@ struct ALEXANDERPLATZ : Module {
         for (int b = 0; b < ALEX_EQ_BANDS; b++) {
             configParam(EQ_PARAM + b, -12.f, 12.f, 0.f, "EQ", " dB");
         }
+
+        polybus::attachBus(this, busFrames);
     }
 
     void process(const ProcessArgs& args) override {
@@ -167,14 +174,34 @@ struct ALEXANDERPLATZ : Module {
         mixL += inputs[CHAIN_LEFT_INPUT].getVoltage();
         mixR += inputs[CHAIN_RIGHT_INPUT].getVoltage();
 
+        // The left neighbour's output joins with the chain inputs, before EQ.
+        // Cable chaining takes over whenever a chain input is patched.
+        if (joinsBus()) {
+            // Mono like the chain inputs: channel 0 of a poly neighbour
+            const polybus::BusFrame* bus = polybus::busInput(this);
+            if (bus && bus->channels > 0) {
+                mixL += bus->left[0];
+                mixR += bus->right[0];
+            }
+        }
+
         // Apply EQ
         for (int b = 0; b < ALEX_EQ_BANDS; b++) {
             mixL = eqFiltersL[b].process(mixL);
             mixR = eqFiltersR[b].process(mixR);
         }
 
-        outputs[LEFT_OUTPUT].setVoltage(clamp(mixL, -10.f, 10.f));
-        outputs[RIGHT_OUTPUT].setVoltage(clamp(mixR, -10.f, 10.f));
+        mixL = clamp(mixL, -10.f, 10.f);
+        mixR = clamp(mixR, -10.f, 10.f);
+        outputs[LEFT_OUTPUT].setVoltage(mixL);
+        outputs[RIGHT_OUTPUT].setVoltage(mixR);
+
+        // The right neighbour receives exactly what leaves the mix outputs
+        if (polybus::BusFrame* busFrame = polybus::busOutput(this)) {
+            busFrame->left[0] = mixL;
+            busFrame->right[0] = mixR;
+            polybus::publishBus(this, busFrame, 1);
+        }
 
         // Update EQ coefficients
         bool needsUpdate = (args.sampleRate != lastSampleRate);
@@ -190,6 +217,50 @@ struct ALEXANDERPLATZ : Module {
             }
         }
     }
+
+    bool joinsBus() {
+        return expanderBus
+            && !inputs[CHAIN_LEFT_INPUT].isConnected() && !inputs[CHAIN_RIGHT_INPUT].isConnected();
+    }
+
+    void processBypass(const ProcessArgs& args) override {
+        // Bypassed mixers relay their chain, from the cables or the bus
+        float chainL = inputs[CHAIN_LEFT_INPUT].getVoltage();
+        float chainR = inputs[CHAIN_RIGHT_INPUT].getVoltage();
+        bool hasChain = inputs[CHAIN_LEFT_INPUT].isConnected() || inputs[CHAIN_RIGHT_INPUT].isConnected();
+        if (joinsBus()) {
+            const polybus::BusFrame* bus = polybus::busInput(this);
+            if (bus && bus->channels > 0) {
+                chainL = bus->left[0];
+                chainR = bus->right[0];
+                hasChain = true;
+            }
+        }
+
+        int channels = hasChain ? 1 : 0;
+        outputs[LEFT_OUTPUT].setChannels(channels);
+        outputs[RIGHT_OUTPUT].setChannels(channels);
+        outputs[LEFT_OUTPUT].setVoltage(chainL);
+        outputs[RIGHT_OUTPUT].setVoltage(chainR);
+
+        if (polybus::BusFrame* busFrame = polybus::busOutput(this)) {
+            busFrame->left[0] = chainL;
+            busFrame->right[0] = chainR;
+            polybus::publishBus(this, busFrame, channels);
+        }
+    }
+
+    json_t* dataToJson() override {
+        json_t* root = json_object();
+        json_object_set_new(root, "expanderBus", json_boolean(expanderBus));
+        return root;
+    }
+
+    void dataFromJson(json_t* root) override {
+        json_t* expanderBusJ = json_object_get(root, "expanderBus");
+        if (expanderBusJ)
+            expanderBus = json_boolean_value(expanderBusJ);
+    }
 };
 
 struct ALEXANDERPLATZWidget : ModuleWidget {
@@ -240,6 +311,14 @@ struct ALEXANDERPLATZWidget : ModuleWidget {
             addParam(createParamCentered<RoundSmallBlackKnob>(Vec(x, 355), module, ALEXANDERPLATZ::EQ_PARAM + b));
         }
     }
+
+    void appendContextMenu(ui::Menu* menu) override {
+        ALEXANDERPLATZ* module = getModule<ALEXANDERPLATZ>();
+        if (!module) return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createBoolPtrMenuItem("Sum mixers on the left via expander", "", &module->expanderBus));
+    }
 };
 
 Model* modelALEXANDERPLATZ = createModel<ALEXANDERPLATZ, ALEXANDERPLATZWidget>("ALEXANDERPLATZ");
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+
+// Clock divider/multiplier shared by the Euclidean sequencers. Everything is
+// counted in samples, so long sets don't drift and the per-sample work is an
+// increment and a compare; divides only happen when a tick is scheduled.
+namespace divmult {
+
+// Period of the incoming clock in samples, measured edge to edge
+struct ClockPeriod {
+    static constexpr float DEFAULT_SECONDS = 0.5f;
+    static constexpr float MIN_SECONDS = 0.01f;
+    static constexpr float MAX_SECONDS = 10.0f;
+
+    int64_t samplesSinceClock = -1;  // -1 until the first edge
+    int64_t periodSamples = 0;       // 0 until measured or set
+
+    void reset() {
+        samplesSinceClock = -1;
+        periodSamples = 0;
+    }
+
+    void process(bool clock, float sampleRate) {
+        if (clock) {
+            if (samplesSinceClock > 0) {
+                int64_t minSamples = (int64_t)(MIN_SECONDS * sampleRate);
+                int64_t maxSamples = (int64_t)(MAX_SECONDS * sampleRate);
+                periodSamples = std::min(std::max(samplesSinceClock, minSamples), maxSamples);
+            }
+            samplesSinceClock = 0;
+        }
+        if (samplesSinceClock >= 0) {
+            ++samplesSinceClock;
+        }
+    }
+
+    // For internal clocks that already know their period
+    void set(float seconds, float sampleRate) {
+        periodSamples = std::max((int64_t)1, (int64_t)(seconds * sampleRate + 0.5f));
+    }
+
+    int64_t period(float sampleRate) const {
+        return periodSamples > 0 ? periodSamples : (int64_t)(DEFAULT_SECONDS * sampleRate + 0.5f);
+    }
+};
+
+// Every `division` clocks starts a cycle of `division` periods, which is split
+// into `multiplication` evenly spaced ticks. The next tick position is predicted
+// from the latest period when the previous one fires.
+struct ClockDivMult {
+    int division = 1;
+    int multiplication = 1;
+
+    int dividerCount = 0;
+    int tickIndex = 0;            // ticks already fired this cycle
+    int64_t progress = 0;         // samples since the cycle started
+    int64_t nextTick = 0;         // progress at which tickIndex fires
+    int64_t samplesSinceTick = INT32_MAX;
+    int64_t gateSamples = 0;      // restarts within this long after a tick don't retrigger
+
+    void reset() {
+        dividerCount = 0;
+        tickIndex = 0;
+        progress = 0;
+        nextTick = 0;
+        samplesSinceTick = INT32_MAX;
+    }
+
+    void setRatio(int newDivision, int newMultiplication) {
+        division = std::max(1, newDivision);
+        multiplication = std::max(1, newMultiplication);
+    }
+
+    // Positive values multiply, negative values divide, 0 is 1:1
+    void setDivMult(int divMult) {
+        setRatio(divMult < 0 ? -divMult + 1 : 1, divMult > 0 ? divMult + 1 : 1);
+    }
+
+    bool process(bool clock, int64_t periodSamples, float sampleRate) {
+        ++progress;
+        ++samplesSinceTick;
+
+        bool restart = false;
+        if (clock) {
+            restart = (dividerCount == 0);
+            if (++dividerCount >= division) {
+                dividerCount = 0;
+            }
+        }
+
+        if (restart) {
+            // Behaves like the rising edge of a half-interval gate: a cycle
+            // that restarts while the last tick's gate is still high is absorbed
+            progress = 0;
+            tickIndex = 0;
+            nextTick = 0;
+            gateSamples = std::max((int64_t)(0.001f * sampleRate),
+                                   periodSamples * division / (2 * multiplication));
+            if (samplesSinceTick <= gateSamples) {
+                schedule(periodSamples);
+                return false;
+            }
+        }
+
+        if (tickIndex >= multiplication || progress < nextTick) {
+            return false;
+        }
+        schedule(periodSamples);
+        samplesSinceTick = 0;
+        return true;
+    }
+
+private:
+    void schedule(int64_t periodSamples) {
+        ++tickIndex;
+        int64_t cycleSamples = periodSamples * division;
+        nextTick = (cycleSamples * tickIndex + multiplication - 1) / multiplication;
+    }
+};
+
+} // namespace divmult
@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "SilenceGate.hpp"
 struct DECAPyramid : Module {
     enum ParamId {
         X_PARAM_1, Y_PARAM_1, Z_PARAM_1, LEVEL_PARAM_1, FILTER_PARAM_1, SENDA_PARAM_1, SENDB_PARAM_1,
@@ -72,6 +73,8 @@ struct DECAPyramid : Module {
     float lastFilterValue[8] = {0.f};
     float smoothedFilter[8] = {0.f};
 
+    silence::Gate silenceGate;
+
     DECAPyramid() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
 
@@ -176,6 +179,23 @@ struct DECAPyramid : Module {
         float returnBL = inputs[RETURN_BL_INPUT].getVoltage();
         float returnBR = inputs[RETURN_BR_INPUT].getVoltage();
 
+        // Filters and panners sleep once every track, insert return, send
+        // return and filter tail is silent
+        float inputLevel = std::max({std::abs(returnAL), std::abs(returnAR), std::abs(returnBL), std::abs(returnBR)});
+        for (int track = 0; track < 8; track++) {
+            inputLevel = std::max({inputLevel, std::abs(inputs[AUDIO_INPUT_1 + track * 4].getVoltage()),
+                                   std::abs(inputs[INSERT_RETURN_1 + track].getVoltage())});
+        }
+        if (!silenceGate.wake(inputLevel)) {
+            for (int i = 0; i < 8; i++) {
+                outputs[MASTER_OUTPUT_1 + i].setVoltage(0.0f);
+                outputs[INSERT_SEND_1 + i].setVoltage(0.0f);
+            }
+            outputs[SENDA_OUTPUT].setVoltage(0.0f);
+            outputs[SENDB_OUTPUT].setVoltage(0.0f);
+            return;
+        }
+
         float rtnALevel = params[RTN_A_LEVEL_PARAM].getValue();
         float rtnAFilter = params[RTN_A_FILTER_PARAM].getValue();
         float rtnBLevel = params[RTN_B_LEVEL_PARAM].getValue();
@@ -237,6 +257,8 @@ struct DECAPyramid : Module {
             lastRtnBFilterMode = 0;
         }
 
+        float tailLevel = std::max({std::abs(returnAL), std::abs(returnAR), std::abs(returnBL), std::abs(returnBR)});
+
         returnAL *= rtnALevel;
         returnAR *= rtnALevel;
         returnBL *= rtnBLevel;
@@ -325,6 +347,8 @@ struct DECAPyramid : Module {
                 lastFilterMode[track] = 0;
             }
 
+            tailLevel = std::max(tailLevel, std::abs(audioIn));
+
             float gains[8];
             calculateVBAP(x, y, -z, gains);
 
@@ -348,6 +372,14 @@ struct DECAPyramid : Module {
 
         outputs[SENDA_OUTPUT].setVoltage(sendAOut);
         outputs[SENDB_OUTPUT].setVoltage(sendBOut);
+
+        if (silenceGate.track(std::max(inputLevel, tailLevel), args.sampleRate)) {
+            // Meters would otherwise freeze on their last reading
+            for (int track = 0; track < 8; track++) {
+                vuMeterPre[track].reset();
+                vuMeterPost[track].reset();
+            }
+        }
     }
 
 
@@ -11,7 +11,9 @@
  */
 
 #include "plugin.hpp"
+#include "FastMath.hpp"
 #include "WorldRhythm/MinimalDrumSynth.hpp"
+#include "WorldRhythm/StyleProfiles.hpp"
 
 using namespace worldrhythm;
 
@@ -49,128 +51,9 @@ public:
     }
 };
 
-// ============================================================================
-// 8-voice style presets (from UniRhythm ExtendedStylePreset)
-// ============================================================================
-
-struct DrummerStylePreset {
-    struct VoicePreset {
-        SynthMode mode;
-        float freq;
-        float decay;
-        const char* name;
-        float sweep = 0.f;
-        float bend = 1.f;
-    };
-    VoicePreset voices[8];
-};
-
-// Voice assignments: 0-1=Timeline, 2-3=Foundation, 4-5=Groove, 6-7=Lead
-static const DrummerStylePreset DRUMMER_PRESETS[10] = {
-    // 0: West African
-    {{{SynthMode::SINE, 4500.0f, 60.0f, "Gankogui"},
-      {SynthMode::SINE, 3500.0f, 40.0f, "Bell Lo"},
-      {SynthMode::SINE, 80.0f, 200.0f, "Dununba"},
-      {SynthMode::SINE, 120.0f, 150.0f, "Dunun"},
-      {SynthMode::SINE, 250.0f, 80.0f, "Sangban"},
-      {SynthMode::SINE, 300.0f, 60.0f, "Kenkeni"},
-      {SynthMode::NOISE, 700.0f, 40.0f, "Djembe Slap"},
-      {SynthMode::NOISE, 400.0f, 50.0f, "Djembe Tone"}}},
-
-    // 1: Afro-Cuban
-    {{{SynthMode::SINE, 4000.0f, 20.0f, "Clave"},
-      {SynthMode::SINE, 2000.0f, 30.0f, "Cowbell"},
-      {SynthMode::SINE, 100.0f, 150.0f, "Tumba"},
-      {SynthMode::SINE, 150.0f, 120.0f, "Conga Lo"},
-      {SynthMode::SINE, 350.0f, 70.0f, "Conga Mid"},
-      {SynthMode::SINE, 550.0f, 50.0f, "Quinto"},
-      {SynthMode::NOISE, 3000.0f, 40.0f, "Timbales"},
-      {SynthMode::NOISE, 5000.0f, 25.0f, "Quinto Slap"}}},
-
-    // 2: Brazilian
-    {{{SynthMode::SINE, 4500.0f, 35.0f, "Agogo Hi"},
-      {SynthMode::SINE, 3000.0f, 35.0f, "Agogo Lo"},
-      {SynthMode::SINE, 55.0f, 250.0f, "Surdo"},
-      {SynthMode::SINE, 80.0f, 180.0f, "Surdo 2"},
-      {SynthMode::SINE, 400.0f, 40.0f, "Tamborim"},
-      {SynthMode::NOISE, 500.0f, 50.0f, "Caixa"},
-      {SynthMode::NOISE, 6000.0f, 30.0f, "Ganza"},
-      {SynthMode::NOISE, 8000.0f, 20.0f, "Chocalho"}}},
-
-    // 3: Balkan
-    {{{SynthMode::NOISE, 4000.0f, 25.0f, "Rim"},
-      {SynthMode::NOISE, 3500.0f, 15.0f, "Click"},
-      {SynthMode::SINE, 90.0f, 180.0f, "Tapan Bass"},
-      {SynthMode::SINE, 130.0f, 120.0f, "Tapan Mid"},
-      {SynthMode::SINE, 300.0f, 50.0f, "Tarabuka Doum"},
-      {SynthMode::SINE, 450.0f, 35.0f, "Tarabuka Tek"},
-      {SynthMode::NOISE, 3000.0f, 25.0f, "Tek Hi"},
-      {SynthMode::NOISE, 5000.0f, 20.0f, "Ka"}}},
-
-    // 4: Indian
-    {{{SynthMode::NOISE, 8000.0f, 150.0f, "Manjira"},
-      {SynthMode::NOISE, 6000.0f, 100.0f, "Ghungroo"},
-      {SynthMode::SINE, 65.0f, 300.0f, "Baya Ge"},
-      {SynthMode::SINE, 90.0f, 200.0f, "Baya Ka"},
-      {SynthMode::SINE, 350.0f, 100.0f, "Daya Na"},
-      {SynthMode::SINE, 500.0f, 80.0f, "Daya Tin"},
-      {SynthMode::NOISE, 1500.0f, 60.0f, "Daya Ti"},
-      {SynthMode::NOISE, 2500.0f, 40.0f, "Daya Re"}}},
-
-    // 5: Gamelan
-    {{{SynthMode::SINE, 700.0f, 400.0f, "Kenong"},
-      {SynthMode::SINE, 600.0f, 350.0f, "Kethuk"},
-      {SynthMode::SINE, 90.0f, 800.0f, "Gong"},
-      {SynthMode::SINE, 150.0f, 500.0f, "Kempul"},
-      {SynthMode::SINE, 800.0f, 200.0f, "Bonang Po"},
-      {SynthMode::SINE, 1000.0f, 180.0f, "Bonang Sa"},
-      {SynthMode::SINE, 1200.0f, 250.0f, "Gender"},
-      {SynthMode::SINE, 1400.0f, 220.0f, "Saron"}}},
-
-    // 6: Jazz
-    {{{SynthMode::NOISE, 4500.0f, 120.0f, "Ride"},
-      {SynthMode::NOISE, 2500.0f, 80.0f, "Ride Bell"},
-      {SynthMode::SINE, 50.0f, 200.0f, "Kick"},
-      {SynthMode::SINE, 80.0f, 150.0f, "Kick Ghost"},
-      {SynthMode::NOISE, 500.0f, 100.0f, "Snare"},
-      {SynthMode::NOISE, 400.0f, 60.0f, "Snare Ghost"},
-      {SynthMode::NOISE, 8000.0f, 35.0f, "HiHat Cl"},
-      {SynthMode::NOISE, 6000.0f, 150.0f, "HiHat Op"}}},
-
-    // 7: Electronic
-    {{{SynthMode::NOISE, 9000.0f, 30.0f, "HiHat"},
-      {SynthMode::NOISE, 12000.0f, 20.0f, "HiHat Ac"},
-      {SynthMode::SINE, 45.0f, 280.0f, "808 Kick", 120.f, 0.8f},
-      {SynthMode::SINE, 60.0f, 200.0f, "Kick 2", 80.f, 1.0f},
-      {SynthMode::NOISE, 1500.0f, 70.0f, "Clap"},
-      {SynthMode::NOISE, 2500.0f, 50.0f, "Snare"},
-      {SynthMode::NOISE, 6000.0f, 150.0f, "Open HH"},
-      {SynthMode::SINE, 800.0f, 100.0f, "Perc"}}},
-
-    // 8: Breakbeat
-    {{{SynthMode::NOISE, 8000.0f, 25.0f, "HiHat"},
-      {SynthMode::NOISE, 10000.0f, 15.0f, "HiHat Ac"},
-      {SynthMode::SINE, 55.0f, 180.0f, "Kick", 140.f, 1.0f},
-      {SynthMode::SINE, 70.0f, 120.0f, "Kick Gho", 60.f, 1.2f},
-      {SynthMode::NOISE, 2500.0f, 80.0f, "Snare"},
-      {SynthMode::NOISE, 2000.0f, 50.0f, "Snare Gh"},
-      {SynthMode::NOISE, 4000.0f, 40.0f, "Ghost"},
-      {SynthMode::NOISE, 6000.0f, 100.0f, "Open HH"}}},
-
-    // 9: Techno
-    {{{SynthMode::NOISE, 10000.0f, 20.0f, "HiHat"},
-      {SynthMode::NOISE, 12000.0f, 12.0f, "HiHat Ac"},
-      {SynthMode::SINE, 42.0f, 250.0f, "909 Kick", 160.f, 1.2f},
-      {SynthMode::SINE, 55.0f, 180.0f, "Kick Lay", 100.f, 1.0f},
-      {SynthMode::NOISE, 1800.0f, 55.0f, "Clap"},
-      {SynthMode::NOISE, 3000.0f, 35.0f, "Rim"},
-      {SynthMode::NOISE, 5000.0f, 80.0f, "Open HH"},
-      {SynthMode::SINE, 600.0f, 60.0f, "Tom"}}}
-};
-
 inline void applyDrummerPreset(DrummerSynth& synth, int styleIndex) {
     if (styleIndex < 0 || styleIndex > 9) return;
-    const DrummerStylePreset& preset = DRUMMER_PRESETS[styleIndex];
+    const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
     for (int i = 0; i < 8; i++) {
         synth.setVoiceParams(i, preset.voices[i].mode,
                              preset.voices[i].freq, preset.voices[i].decay,
@@ -320,7 +203,7 @@ struct Drummmmmmer : Module {
         }
 
         // Get base preset for parameter modulation (8 voices)
-        const DrummerStylePreset& preset = DRUMMER_PRESETS[currentStyle];
+        const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[currentStyle];
 
         // Voice variation probability
         float voiceProb = params[VOICE_PARAM].getValue();
@@ -351,9 +234,10 @@ struct Drummmmmmer : Module {
             decayParam = clamp(decayParam, 0.2f, 2.f);
 
             // Apply modulation to both voices (each with its own base freq/decay)
-            float modFreq1 = preset.voices[v1].freq * std::pow(2.f, freqParam);
+            float freqRatio = fastmath::exp2(freqParam);
+            float modFreq1 = preset.voices[v1].freq * freqRatio;
             float modDecay1 = preset.voices[v1].decay * decayParam;
-            float modFreq2 = preset.voices[v2].freq * std::pow(2.f, freqParam);
+            float modFreq2 = preset.voices[v2].freq * freqRatio;
             float modDecay2 = preset.voices[v2].decay * decayParam;
 
             drumSynth.setVoiceParams(v1, preset.voices[v1].mode, modFreq1, modDecay1,
@@ -393,15 +277,15 @@ struct Drummmmmmer : Module {
 
         for (int v = 0; v < 4; v++) {
             float pan = panPositions[v] * spread;
-            float gainL = std::cos((pan + 1.f) * 0.25f * M_PI);
-            float gainR = std::sin((pan + 1.f) * 0.25f * M_PI);
+            float gainL = fastmath::cos2pi((pan + 1.f) * 0.125f);
+            float gainR = fastmath::sin2pi((pan + 1.f) * 0.125f);
             mixL += voiceOutputs[v] * gainL;
             mixR += voiceOutputs[v] * gainR;
         }
 
         // Soft limiting
-        outputs[MIX_L_OUTPUT].setVoltage(std::tanh(mixL) * 5.f);
-        outputs[MIX_R_OUTPUT].setVoltage(std::tanh(mixR) * 5.f);
+        outputs[MIX_L_OUTPUT].setVoltage(fastmath::tanh(mixL) * 5.f);
+        outputs[MIX_R_OUTPUT].setVoltage(fastmath::tanh(mixR) * 5.f);
     }
 
     json_t* dataToJson() override {
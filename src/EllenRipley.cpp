@@ -1,40 +1,12 @@
 #include "plugin.hpp"
+#include "GrainEngine.hpp"
+#include "LorenzChaos.hpp"
+#include "SilenceGate.hpp"
 
 using namespace rack;
 using namespace rack::engine;
 using namespace rack::math;
 
-struct ChaosGenerator {
-    float x = 0.1f;
-    float y = 0.1f;
-    float z = 0.1f;
-    
-    void reset() {
-        x = 0.1f;
-        y = 0.1f;
-        z = 0.1f;
-    }
-    
-    float process(float rate) {
-        float dt = rate * 0.001f;
-        
-        float dx = 7.5f * (y - x);
-        float dy = x * (30.9f - z) - y;
-        float dz = x * y - 1.02f * z;
-        
-        x += dx * dt;
-        y += dy * dt;
-        z += dz * dt;
-        
-        if (std::isnan(x) || std::isnan(y) || std::isnan(z) || 
-            std::abs(x) > 100.0f || std::abs(y) > 100.0f || std::abs(z) > 100.0f) {
-            reset();
-        }
-        
-        return clamp(x * 0.1f, -1.0f, 1.0f);
-    }
-};
-
 struct ReverbProcessor {
     static constexpr int COMB_1_SIZE = 1557;
     static constexpr int COMB_2_SIZE = 1617;
@@ -181,124 +153,8 @@ struct ReverbProcessor {
     }
 };
 
-struct GrainProcessor {
-    static constexpr int GRAIN_BUFFER_SIZE = 8192;
-    float grainBuffer[GRAIN_BUFFER_SIZE];
-    int grainWriteIndex = 0;
-    
-    struct Grain {
-        bool active = false;
-        float position = 0.0f;
-        float size = 0.0f;
-        float envelope = 0.0f;
-        float direction = 1.0f;
-        float pitch = 1.0f;
-    };
-    
-    static constexpr int MAX_GRAINS = 16;
-    Grain grains[MAX_GRAINS];
-    
-    float phase = 0.0f;
-    dsp::SchmittTrigger grainTrigger;
-    
-    void reset() {
-        for (int i = 0; i < GRAIN_BUFFER_SIZE; i++) {
-            grainBuffer[i] = 0.0f;
-        }
-        grainWriteIndex = 0;
-        
-        for (int i = 0; i < MAX_GRAINS; i++) {
-            grains[i].active = false;
-        }
-        phase = 0.0f;
-    }
-    
-    float process(float input, float grainSize, float density, float position, 
-                  bool chaosEnabled, float chaosOutput, float sampleRate) {
-        
-        grainBuffer[grainWriteIndex] = input;
-        grainWriteIndex = (grainWriteIndex + 1) % GRAIN_BUFFER_SIZE;
-        
-        float grainSizeMs = grainSize * 99.0f + 1.0f;
-        float grainSamples = (grainSizeMs / 1000.0f) * sampleRate;
-        
-        float densityValue = density;
-        if (chaosEnabled) {
-            densityValue += chaosOutput * 0.3f;
-        }
-        densityValue = clamp(densityValue, 0.0f, 1.0f);
-        
-        float triggerRate = densityValue * 50.0f + 1.0f;
-        phase += triggerRate / sampleRate;
-        
-        if (phase >= 1.0f) {
-            phase -= 1.0f;
-            
-            for (int i = 0; i < MAX_GRAINS; i++) {
-                if (!grains[i].active) {
-                    grains[i].active = true;
-                    grains[i].size = grainSamples;
-                    grains[i].envelope = 0.0f;
-                    
-                    float pos = position;
-                    if (chaosEnabled) {
-                        pos += chaosOutput * 20.0f;
-                        if (random::uniform() < 0.3f) {
-                            grains[i].direction = -1.0f;
-                        } else {
-                            grains[i].direction = 1.0f;
-                        }
-                        
-                        if (densityValue > 0.7f && random::uniform() < 0.2f) {
-                            grains[i].pitch = random::uniform() < 0.5f ? 0.5f : 2.0f;
-                        } else {
-                            grains[i].pitch = 1.0f;
-                        }
-                    } else {
-                        grains[i].direction = 1.0f;
-                        grains[i].pitch = 1.0f;
-                    }
-                    
-                    pos = clamp(pos, 0.0f, 1.0f);
-                    grains[i].position = pos * GRAIN_BUFFER_SIZE;
-                    break;
-                }
-            }
-        }
-        
-        float output = 0.0f;
-        int activeGrains = 0;
-        
-        for (int i = 0; i < MAX_GRAINS; i++) {
-            if (grains[i].active) {
-                float envPhase = grains[i].envelope / grains[i].size;
-                
-                if (envPhase >= 1.0f) {
-                    grains[i].active = false;
-                    continue;
-                }
-                
-                float env = 0.5f * (1.0f - cos(envPhase * 2.0f * M_PI));
-                
-                int readPos = (int)grains[i].position;
-                readPos = (readPos + GRAIN_BUFFER_SIZE) % GRAIN_BUFFER_SIZE;
-                
-                float sample = grainBuffer[readPos];
-                output += sample * env;
-                
-                grains[i].position += grains[i].direction * grains[i].pitch;
-                grains[i].envelope += 1.0f;
-                activeGrains++;
-            }
-        }
-        
-        if (activeGrains > 0) {
-            output /= sqrt(activeGrains);
-        }
-        
-        return output;
-    }
-};
+// 8192-sample grain buffer, up to 64 overlapping grains
+using GrainProcessor = granular::GrainEngine<8192, 64>;
 
 struct EllenRipley : rack::engine::Module {
     enum ParamIds {
@@ -355,7 +211,10 @@ struct EllenRipley : rack::engine::Module {
     float rightDelayBuffer[DELAY_BUFFER_SIZE];
     int delayWriteIndex = 0;
     
-    ChaosGenerator chaosGen;
+    // Hold covers the longest delay time, so echoes still in the line keep it awake
+    silence::Gate silenceGate{2.5f};
+    
+    chaos::Lorenz chaosGen;
     GrainProcessor leftGrainProcessor;
     GrainProcessor rightGrainProcessor;
     ReverbProcessor leftReverbProcessor;
@@ -427,6 +286,7 @@ struct EllenRipley : rack::engine::Module {
             rightDelayBuffer[i] = 0.0f;
         }
         delayWriteIndex = 0;
+        silenceGate.reset();
     }
     
     void process(const ProcessArgs& args) override {
@@ -471,6 +331,14 @@ struct EllenRipley : rack::engine::Module {
         float leftInput = inputs[LEFT_AUDIO_INPUT].getVoltage();
         float rightInput = inputs[RIGHT_AUDIO_INPUT].isConnected() ? inputs[RIGHT_AUDIO_INPUT].getVoltage() : leftInput;
         
+        // Delay, grains and reverb sleep once input and tails are silent
+        float inputLevel = std::max(std::abs(leftInput), std::abs(rightInput));
+        if (!silenceGate.wake(inputLevel)) {
+            outputs[LEFT_AUDIO_OUTPUT].setVoltage(0.0f);
+            outputs[RIGHT_AUDIO_OUTPUT].setVoltage(0.0f);
+            return;
+        }
+        
         float delayTimeL = params[DELAY_TIME_L_PARAM].getValue();
         if (inputs[DELAY_TIME_L_CV_INPUT].isConnected()) {
             float cv = inputs[DELAY_TIME_L_CV_INPUT].getVoltage();
@@ -578,6 +446,11 @@ struct EllenRipley : rack::engine::Module {
         leftDelayBuffer[delayWriteIndex] += leftReverbOutput * reverbFeedbackAmount;
         rightDelayBuffer[delayWriteIndex] += rightReverbOutput * reverbFeedbackAmount;
         
+        float tailLevel = std::max({std::abs(leftDelayedSignal), std::abs(rightDelayedSignal),
+                                    std::abs(leftGrainOutput), std::abs(rightGrainOutput),
+                                    std::abs(leftReverbOutput), std::abs(rightReverbOutput)});
+        silenceGate.track(std::max(inputLevel, tailLevel), args.sampleRate);
+        
         outputs[LEFT_AUDIO_OUTPUT].setVoltage(leftFinal);
         outputs[RIGHT_AUDIO_OUTPUT].setVoltage(rightFinal);
     }
@@ -1,157 +1,134 @@
 #include "plugin.hpp"
+#include "PolyBus.hpp"
 #include <cmath>
 
-// AD/AHR Envelope class (based on ADGenerator)
-struct ADEnvelope {
+using simd::float_4;
+
+// AD/AHR envelopes for all six channels (based on ADGenerator), four
+// channels per float_4. Stage times are derived from the knobs only when
+// a knob moves; the per-sample work is a handful of vector compares.
+struct ADEnvelopeBank {
     enum Phase {
         IDLE,
         ATTACK,
-        HOLD,    // New hold phase for AHR mode
+        HOLD,    // AHR mode only, held while the gate stays high
         DECAY    // Also serves as Release in AHR mode
     };
 
-    Phase phase = IDLE;
-    float triggerOutput = 0.0f;
-    float followerOutput = 0.0f;
-    float attackTime = 0.01f;
-    float decayTime = 1.0f;
-    float phaseTime = 0.0f;
-    float curve = -0.9f;  // Default shape
-    float followerState = 0.0f;
-    float attackCoeff = 0.0f;
-    float releaseCoeff = 0.0f;
-    bool ahrMode = false;  // false = AD mode, true = AHR mode
-    bool gateHigh = false; // Track gate state for AHR mode
-
-    dsp::SchmittTrigger trigger;
-
-    void reset() {
-        phase = IDLE;
-        triggerOutput = 0.0f;
-        followerOutput = 0.0f;
-        phaseTime = 0.0f;
-        followerState = 0.0f;
-    }
-
-    float applyCurve(float x, float curvature) {
-        x = clamp(x, 0.0f, 1.0f);
-
-        if (curvature == 0.0f) {
-            return x;
+    static constexpr int CHANNELS = 6;
+    static constexpr int GROUPS = (CHANNELS + 3) / 4;
+    static constexpr float CURVE = -0.9f;  // Default shape
+
+    float_4 phase[GROUPS];
+    float_4 elapsed[GROUPS];      // seconds into the current stage
+    float_4 output[GROUPS];
+    float_4 gateHigh[GROUPS];     // mask, gate state on the previous sample
+    float_4 ahrMode[GROUPS];      // 0 = AD, 1 = AHR
+    float_4 attackTime[GROUPS];   // seconds
+    float_4 decayTime[GROUPS];
+    float_4 invAttack[GROUPS];
+    float_4 invDecay[GROUPS];
+    dsp::TSchmittTrigger<float_4> triggers[GROUPS];
+
+    float lastAttack[CHANNELS];
+    float lastDecay[CHANNELS];
+
+    ADEnvelopeBank() {
+        for (int g = 0; g < GROUPS; g++) {
+            phase[g] = (float)IDLE;
+            elapsed[g] = 0.f;
+            output[g] = 0.f;
+            gateHigh[g] = float_4::zero();
+            ahrMode[g] = 0.f;
+            attackTime[g] = 1.f;
+            decayTime[g] = 1.f;
+            invAttack[g] = 1.f;
+            invDecay[g] = 1.f;
         }
-
-        float k = curvature;
-        float abs_x = std::abs(x);
-        float denominator = k - 2.0f * k * abs_x + 1.0f;
-
-        if (std::abs(denominator) < 1e-6f) {
-            return x;
+        for (int i = 0; i < CHANNELS; i++) {
+            lastAttack[i] = -1.f;
+            lastDecay[i] = -1.f;
         }
-
-        return (x - k * x) / denominator;
     }
 
-    float processEnvelopeFollower(float triggerVoltage, float sampleTime, float attackTime, float releaseTime, float curve) {
-        attackCoeff = 1.0f - std::exp(-sampleTime / std::max(0.0005f, attackTime * 0.1f));
-        releaseCoeff = 1.0f - std::exp(-sampleTime / std::max(0.001f, releaseTime * 0.5f));
-
-        attackCoeff = clamp(attackCoeff, 0.0f, 1.0f);
-        releaseCoeff = clamp(releaseCoeff, 0.0f, 1.0f);
-
-        float rectified = std::abs(triggerVoltage) / 10.0f;
-        rectified = clamp(rectified, 0.0f, 1.0f);
-
-        float targetCoeff;
-        if (rectified > followerState) {
-            float progress = attackCoeff;
-            targetCoeff = applyCurve(progress, curve);
-        } else {
-            float progress = releaseCoeff;
-            targetCoeff = applyCurve(progress, curve);
-        }
-
-        targetCoeff = clamp(targetCoeff, 0.0f, 1.0f);
-
-        followerState += (rectified - followerState) * targetCoeff;
-        followerState = clamp(followerState, 0.0f, 1.0f);
-
-        return followerState;
+    static float knobToSeconds(float knob) {
+        return std::max(0.001f, std::pow(10.0f, (knob - 0.5f) * 6.0f));
     }
 
-    float processTriggerEnvelope(float triggerVoltage, float sampleTime, float attack, float decay, float curve) {
-        bool currentGateHigh = triggerVoltage > 1.0f;
-
-        // Trigger on rising edge (SchmittTrigger uses 0.1V low / 2.0V high thresholds)
-        if (trigger.process(triggerVoltage)) {
-            phase = ATTACK;
-            phaseTime = 0.0f;
-        }
-
-        // In AHR mode, detect gate release to start release phase
-        if (ahrMode && gateHigh && !currentGateHigh && phase == HOLD) {
-            phase = DECAY;  // Start release phase
-            phaseTime = 0.0f;
+    // Cheap to call every sample, the pow() only runs when a knob moves
+    void setKnobs(int i, float attack, float decay, bool ahr) {
+        if (attack != lastAttack[i]) {
+            lastAttack[i] = attack;
+            attackTime[i / 4][i % 4] = knobToSeconds(attack);
+            invAttack[i / 4][i % 4] = 1.f / attackTime[i / 4][i % 4];
         }
-        gateHigh = currentGateHigh;
-
-        switch (phase) {
-            case IDLE:
-                triggerOutput = 0.0f;
-                break;
-
-            case ATTACK:
-                phaseTime += sampleTime;
-                if (phaseTime >= attack) {
-                    if (ahrMode) {
-                        phase = HOLD;  // Go to hold phase in AHR mode
-                        triggerOutput = 1.0f;
-                    } else {
-                        phase = DECAY;  // Go directly to decay in AD mode
-                        phaseTime = 0.0f;
-                    }
-                    triggerOutput = 1.0f;
-                } else {
-                    float t = phaseTime / attack;
-                    triggerOutput = applyCurve(t, curve);
-                }
-                break;
-
-            case HOLD:
-                // Stay at full level while gate is high (AHR mode only)
-                triggerOutput = 1.0f;
-                if (!gateHigh) {
-                    phase = DECAY;
-                    phaseTime = 0.0f;
-                }
-                break;
-
-            case DECAY:
-                phaseTime += sampleTime;
-                if (phaseTime >= decay) {
-                    triggerOutput = 0.0f;
-                    phase = IDLE;
-                    phaseTime = 0.0f;
-                } else {
-                    float t = phaseTime / decay;
-                    triggerOutput = 1.0f - applyCurve(t, curve);
-                }
-                break;
+        if (decay != lastDecay[i]) {
+            lastDecay[i] = decay;
+            decayTime[i / 4][i % 4] = knobToSeconds(decay);
+            invDecay[i / 4][i % 4] = 1.f / decayTime[i / 4][i % 4];
         }
-
-        return clamp(triggerOutput, 0.0f, 1.0f);
+        ahrMode[i / 4][i % 4] = ahr ? 1.f : 0.f;
     }
 
-    float process(float sampleTime, float triggerVoltage, float attack, float decay) {
-        float attackTime = std::pow(10.0f, (attack - 0.5f) * 6.0f);
-        float decayTime = std::pow(10.0f, (decay - 0.5f) * 6.0f);
+    bool isIdle(int i) const {
+        return phase[i / 4][i % 4] == (float)IDLE;
+    }
 
-        attackTime = std::max(0.001f, attackTime);
-        decayTime = std::max(0.001f, decayTime);
+    float get(int i) const {
+        return output[i / 4][i % 4];
+    }
 
-        // Only use trigger envelope - gate voltage amplitude should NOT affect envelope output
-        float triggerEnv = processTriggerEnvelope(triggerVoltage, sampleTime, attackTime, decayTime, curve);
+    // Rational curve (x - kx) / (k - 2k|x| + 1); with k = -0.9 the
+    // denominator stays >= 0.1 over 0..1, so no guard is needed
+    static float_4 applyCurve(float_4 x) {
+        x = simd::clamp(x, 0.f, 1.f);
+        return (x - CURVE * x) / (CURVE - 2.f * CURVE * x + 1.f);
+    }
 
-        return triggerEnv;
+    // Gates are voltages; only their edges and the 1 V level matter, so
+    // gate amplitude never scales the envelope
+    void process(const float_4* gates, float sampleTime) {
+        for (int g = 0; g < GROUPS; g++) {
+            float_4 high = gates[g] > 1.f;
+            float_4 ahr = ahrMode[g] > 0.f;
+
+            // Trigger on rising edge
+            float_4 triggered = triggers[g].process(gates[g], 0.f, 1.f);
+            float_4 p = simd::ifelse(triggered, float_4((float)ATTACK), phase[g]);
+            float_4 t = simd::ifelse(triggered, float_4::zero(), elapsed[g]);
+
+            // In AHR mode, a falling gate while holding starts the release
+            float_4 released = ahr & gateHigh[g] & ~high & (p == (float)HOLD);
+            p = simd::ifelse(released, float_4((float)DECAY), p);
+            t = simd::ifelse(released, float_4::zero(), t);
+            gateHigh[g] = high;
+
+            float_4 inAttack = p == (float)ATTACK;
+            float_4 inHold = p == (float)HOLD;
+            float_4 inDecay = p == (float)DECAY;
+
+            float_4 advanced = t + sampleTime;
+            float_4 attackDone = inAttack & (advanced >= attackTime[g]);
+            float_4 decayDone = inDecay & (advanced >= decayTime[g]);
+            float_4 holdDone = inHold & ~high;
+
+            // Stage outputs; IDLE lanes fall through to 0
+            float_4 out = float_4::zero();
+            out = simd::ifelse(inAttack, simd::ifelse(attackDone, float_4(1.f), applyCurve(advanced * invAttack[g])), out);
+            out = simd::ifelse(inHold, float_4(1.f), out);
+            out = simd::ifelse(inDecay, simd::ifelse(decayDone, float_4::zero(), 1.f - applyCurve(advanced * invDecay[g])), out);
+            output[g] = simd::clamp(out, 0.f, 1.f);
+
+            t = simd::ifelse(inAttack | inDecay, advanced, t);
+            t = simd::ifelse(attackDone | holdDone | decayDone, float_4::zero(), t);
+            elapsed[g] = t;
+
+            // AD goes straight from attack to decay, AHR holds first
+            p = simd::ifelse(attackDone, simd::ifelse(ahr, float_4((float)HOLD), float_4((float)DECAY)), p);
+            p = simd::ifelse(holdDone, float_4((float)DECAY), p);
+            p = simd::ifelse(decayDone, float_4((float)IDLE), p);
+            phase[g] = p;
+        }
     }
 };
 
@@ -280,7 +257,7 @@ struct EnvVCA6 : Module {
         LIGHTS_LEN
     };
 
-    ADEnvelope envelopes[6];
+    ADEnvelopeBank envelopes;
     dsp::SchmittTrigger sumLatchTriggers[6]; // Only for sum latch buttons
     bool gateOutputStates[6] = {false}; // Track gate output states
     bool lastEnvelopeActive[6] = {false}; // Track envelope state for end-of-cycle trigger
@@ -346,52 +323,65 @@ struct EnvVCA6 : Module {
     }
 
     void process(const ProcessArgs& args) override {
+        // Knobs and gates first, so all six envelopes advance in one pass
+        float combinedGates[6];
+        float_4 gates[ADEnvelopeBank::GROUPS];
+        for (int g = 0; g < ADEnvelopeBank::GROUPS; g++) {
+            gates[g] = 0.f;
+        }
         for (int i = 0; i < 6; i++) {
-            // Get parameters for this channel (6 params per channel)
             float attackParam = params[CH1_ATTACK_PARAM + i * 6].getValue();
             float releaseParam = params[CH1_RELEASE_PARAM + i * 6].getValue();
-            float outVolParam = params[CH1_OUT_VOL_PARAM + i * 6].getValue();
             bool ahrMode = params[CH1_ENV_MODE_PARAM + i * 6].getValue() > 0.5f;
+            envelopes.setKnobs(i, attackParam, releaseParam, ahrMode);
 
-            // Set envelope mode
-            envelopes[i].ahrMode = ahrMode;
+            // Manual gate logic: momentary (only while button pressed)
+            bool manualGateActive = params[CH1_GATE_TRIG_PARAM + i * 6].getValue() > 0.5f;
 
-            // Get inputs
-            float inL = inputs[CH1_IN_L_INPUT + i * 4].getVoltage();
-            float inR = inputs[CH1_IN_R_INPUT + i * 4].getVoltage();
+            // Combine gate sources (input + momentary manual gate)
             float gateIn = inputs[CH1_GATE_INPUT + i * 4].getVoltage();
-            float volCtrl = inputs[CH1_VOL_CTRL_INPUT + i * 4].getVoltage();
+            combinedGates[i] = std::max(gateIn, manualGateActive ? 10.f : 0.f);
+            gates[i / 4][i % 4] = combinedGates[i];
+        }
 
-            // Mono-to-stereo: if only L input connected, copy to R
-            if (!inputs[CH1_IN_R_INPUT + i * 4].isConnected() && inputs[CH1_IN_L_INPUT + i * 4].isConnected()) {
-                inR = inL;
-            }
+        envelopes.process(gates, args.sampleTime);
 
-            // Manual gate logic: momentary (only while button pressed)
-            bool manualGateActive = params[CH1_GATE_TRIG_PARAM + i * 6].getValue() > 0.5f;
+        // Polyphonic VCA results, kept until the CH6 sum is added
+        float_4 audioL[6][4];
+        float_4 audioR[6][4];
+        int audioChannels[6];
 
-            // Combine gate sources (input + momentary manual gate)
-            float combinedGate = std::max(gateIn, manualGateActive ? 10.f : 0.f);
+        for (int i = 0; i < 6; i++) {
+            float outVolParam = params[CH1_OUT_VOL_PARAM + i * 6].getValue();
+            float combinedGate = combinedGates[i];
+            float envelopeOutput = envelopes.get(i);
 
-            // Process envelope
-            float envelopeOutput = envelopes[i].process(args.sampleTime, combinedGate, attackParam, releaseParam);
+            // Envelope and output volume are shared by every voice of the channel
+            float vcaGain = envelopeOutput * outVolParam;
 
-            // Apply VCA (envelope controls volume)
-            float vcaGain = envelopeOutput;
+            polybus::PortState inL, inR, volCtrl;
+            inL.read(inputs[CH1_IN_L_INPUT + i * 4]);
+            inR.read(inputs[CH1_IN_R_INPUT + i * 4]);
+            volCtrl.read(inputs[CH1_VOL_CTRL_INPUT + i * 4]);
 
-            // Apply volume control CV (0-10V range) - default to 1.0 if not connected
-            float volCtrlGain = 1.f;
-            if (inputs[CH1_VOL_CTRL_INPUT + i * 4].isConnected()) {
-                volCtrlGain = clamp(volCtrl / 10.f, 0.f, 1.f);
-            }
-            vcaGain *= volCtrlGain;
+            // Mono-to-stereo: if only L input connected, copy to R
+            engine::Input& sourceR = inR.connected ? inputs[CH1_IN_R_INPUT + i * 4] : inputs[CH1_IN_L_INPUT + i * 4];
+            const polybus::PortState& stateR = inR.connected ? inR : inL;
 
-            // Apply output volume knob
-            vcaGain *= outVolParam;
+            int channels = std::max(1, std::max(inL.channels, inR.channels));
+            audioChannels[i] = channels;
 
-            // Process audio
-            float outL = inL * vcaGain;
-            float outR = inR * vcaGain;
+            for (int c = 0; c < channels; c += 4) {
+                // Volume control CV (0-10V range) per voice, a mono CV covers all voices
+                float_4 gain = vcaGain;
+                if (volCtrl.connected) {
+                    gain *= simd::clamp(polybus::loadOrFirst(inputs[CH1_VOL_CTRL_INPUT + i * 4], volCtrl, c) / 10.f, 0.f, 1.f);
+                }
+                // Voices past the channel count stay silent for the CH6 sum
+                float_4 lanes = polybus::laneMask(c, channels);
+                audioL[i][c / 4] = polybus::loadOrFirst(inputs[CH1_IN_L_INPUT + i * 4], inL, c) * gain & lanes;
+                audioR[i][c / 4] = polybus::loadOrFirst(sourceR, stateR, c) * gain & lanes;
+            }
 
             // Gate output logic (three modes)
             float gateOutputVoltage = 0.f;
@@ -401,7 +391,7 @@ struct EnvVCA6 : Module {
                 if (combinedGate > 1.f) {
                     gateOutputStates[i] = true;
                 }
-                if (envelopes[i].phase == ADEnvelope::IDLE && envelopeOutput <= 0.001f) {
+                if (envelopes.isIdle(i) && envelopeOutput <= 0.001f) {
                     gateOutputStates[i] = false;
                 }
                 gateOutputVoltage = gateOutputStates[i] ? 10.f : 0.f;
@@ -437,48 +427,61 @@ struct EnvVCA6 : Module {
                 gateOutputVoltage = (startTrigger || endTrigger) ? 10.f : 0.f;
             }
 
-            // Set outputs
             outputs[CH1_GATE_OUTPUT + i * 4].setVoltage(gateOutputVoltage);
             outputs[CH1_ENV_OUTPUT + i * 4].setVoltage(envelopeOutput * 10.f);
-            outputs[CH1_OUT_L_OUTPUT + i * 4].setVoltage(outL);
-            outputs[CH1_OUT_R_OUTPUT + i * 4].setVoltage(outR);
 
-            // VCA light shows current VCA level
-            lights[CH1_VCA_LIGHT + i].setBrightness(vcaGain);
+            // VCA light shows the current level of the first voice
+            float lightGain = vcaGain;
+            if (volCtrl.connected) {
+                lightGain *= clamp(inputs[CH1_VOL_CTRL_INPUT + i * 4].getVoltage() / 10.f, 0.f, 1.f);
+            }
+            lights[CH1_VCA_LIGHT + i].setBrightness(lightGain);
         }
 
         // Sum outputs to CH6 (if sum latch is enabled) - ADD to CH6, don't replace
-        float sumL = 0.f;
-        float sumR = 0.f;
         float sumEnv = 0.f;
         int sumCount = 0;
 
         for (int i = 0; i < 5; i++) { // Only sum first 5 channels (CH1-CH5)
             bool sumEnabled = params[CH1_SUM_LATCH_PARAM + i * 6].getValue() > 0.5f;
             if (sumEnabled) {
-                sumL += outputs[CH1_OUT_L_OUTPUT + i * 4].getVoltage() * 0.3f; // Scale for mixing
-                sumR += outputs[CH1_OUT_R_OUTPUT + i * 4].getVoltage() * 0.3f;
+                // Voice by voice, widening CH6 to the widest summed channel.
+                // Lanes past CH6's count are already zero, so only groups it
+                // never wrote need clearing
+                int channels = audioChannels[i];
+                for (int c = (audioChannels[5] + 3) / 4 * 4; c < channels; c += 4) {
+                    audioL[5][c / 4] = 0.f;
+                    audioR[5][c / 4] = 0.f;
+                }
+                for (int c = 0; c < channels; c += 4) {
+                    audioL[5][c / 4] += audioL[i][c / 4] * 0.3f; // Scale for mixing
+                    audioR[5][c / 4] += audioR[i][c / 4] * 0.3f;
+                }
+                audioChannels[5] = std::max(audioChannels[5], channels);
 
                 // Sum envelopes with RMS-like scaling to prevent overload
-                float envValue = outputs[CH1_ENV_OUTPUT + i * 4].getVoltage() / 10.f; // Convert to 0-1
+                float envValue = envelopes.get(i);
                 sumEnv += envValue * envValue; // Square for RMS
                 sumCount++;
             }
         }
 
-        // ADD sum to CH6 outputs (not replace) if any channels are summed
+        // Add RMS envelope sum to CH6's envelope
         if (sumCount > 0) {
-            // Add summed audio to CH6's own output
-            float ch6L = outputs[CH1_OUT_L_OUTPUT + 5 * 4].getVoltage();
-            float ch6R = outputs[CH1_OUT_R_OUTPUT + 5 * 4].getVoltage();
-            outputs[CH1_OUT_L_OUTPUT + 5 * 4].setVoltage(ch6L + sumL);
-            outputs[CH1_OUT_R_OUTPUT + 5 * 4].setVoltage(ch6R + sumR);
-
-            // Add RMS envelope sum to CH6's envelope
             float ch6Env = outputs[CH1_ENV_OUTPUT + 5 * 4].getVoltage();
             float rmsEnv = std::sqrt(sumEnv / sumCount) * 10.f; // Back to 0-10V range
             outputs[CH1_ENV_OUTPUT + 5 * 4].setVoltage(std::max(ch6Env, rmsEnv)); // Use max to preserve CH6 envelope
         }
+
+        for (int i = 0; i < 6; i++) {
+            int channels = audioChannels[i];
+            outputs[CH1_OUT_L_OUTPUT + i * 4].setChannels(channels);
+            outputs[CH1_OUT_R_OUTPUT + i * 4].setChannels(channels);
+            for (int c = 0; c < channels; c += 4) {
+                outputs[CH1_OUT_L_OUTPUT + i * 4].setVoltageSimd(audioL[i][c / 4], c);
+                outputs[CH1_OUT_R_OUTPUT + i * 4].setVoltageSimd(audioR[i][c / 4], c);
+            }
+        }
     }
 };
 
@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "ClockDivMult.hpp"
 
 struct DivMultParamQuantity : ParamQuantity {
     std::string getDisplayValueString() override {
@@ -111,24 +112,14 @@ struct EuclideanRhythm : Module {
     dsp::SchmittTrigger resetTrigger;
     dsp::SchmittTrigger manualResetTrigger;
     
-    float globalClockSeconds = 0.5f;
-    float secondsSinceLastClock = -1.0f;
+    divmult::ClockPeriod clockPeriod;
     
     dsp::PulseGenerator orRedPulse;
     dsp::PulseGenerator orGreenPulse;
     dsp::PulseGenerator orBluePulse;
 
     struct TrackState {
-        int divMultValue = 0;
-        int division = 1;
-        int multiplication = 1;
-        float dividedClockSeconds = 0.5f;
-        float multipliedClockSeconds = 0.5f;
-        float dividedProgressSeconds = 0.0f;
-        float gateSeconds = 0.0f;
-        int dividerCount = 0;
-        bool shouldStep = false;
-        bool prevMultipliedGate = false;
+        divmult::ClockDivMult clockDivMult;
         
         int currentStep = 0;
         int length = 16;
@@ -140,10 +131,7 @@ struct EuclideanRhythm : Module {
         dsp::PulseGenerator trigPulse;
 
         void reset() {
-            dividedProgressSeconds = 0.0f;
-            dividerCount = 0;
-            shouldStep = false;
-            prevMultipliedGate = false;
+            clockDivMult.reset();
             currentStep = 0;
             for (int i = 0; i < 32; ++i) {
                 pattern[i] = false;
@@ -152,56 +140,6 @@ struct EuclideanRhythm : Module {
             cycleCompleted = false;
         }
         
-        void updateDivMult(int divMultParam) {
-            divMultValue = divMultParam;
-            if (divMultValue > 0) {
-                division = 1;
-                multiplication = divMultValue + 1;
-            } else if (divMultValue < 0) {
-                division = -divMultValue + 1;
-                multiplication = 1;
-            } else {
-                division = 1;
-                multiplication = 1;
-            }
-        }
-        
-        bool processClockDivMult(bool globalClock, float globalClockSeconds, float sampleTime) {
-            dividedClockSeconds = globalClockSeconds * (float)division;
-            multipliedClockSeconds = dividedClockSeconds / (float)multiplication;
-            gateSeconds = std::max(0.001f, multipliedClockSeconds * 0.5f);
-            
-            if (globalClock) {
-                if (dividerCount < 1) {
-                    dividedProgressSeconds = 0.0f;
-                } else {
-                    dividedProgressSeconds += sampleTime;
-                }
-                ++dividerCount;
-                if (dividerCount >= division) {
-                    dividerCount = 0;
-                }
-            } else {
-                dividedProgressSeconds += sampleTime;
-            }
-            
-            shouldStep = false;
-            if (dividedProgressSeconds < dividedClockSeconds) {
-                float multipliedProgressSeconds = dividedProgressSeconds / multipliedClockSeconds;
-                multipliedProgressSeconds -= (float)(int)multipliedProgressSeconds;
-                multipliedProgressSeconds *= multipliedClockSeconds;
-                
-                bool currentMultipliedGate = multipliedProgressSeconds <= gateSeconds;
-                
-                if (currentMultipliedGate && !prevMultipliedGate) {
-                    shouldStep = true;
-                }
-                prevMultipliedGate = currentMultipliedGate;
-            }
-            
-            return shouldStep;
-        }
-        
         void stepTrack() {
             cycleCompleted = false;
             currentStep = (currentStep + 1) % length;
@@ -245,7 +183,7 @@ struct EuclideanRhythm : Module {
         }
         
         int calculateTrackCycleClock(const TrackState& track) {
-            return track.length * track.division / track.multiplication;
+            return track.length * track.clockDivMult.division / track.clockDivMult.multiplication;
         }
         
         float processStep(TrackState tracks[], float sampleTime, bool globalClockTriggered) {
@@ -385,8 +323,7 @@ struct EuclideanRhythm : Module {
     }
 
     void onReset() override {
-        secondsSinceLastClock = -1.0f;
-        globalClockSeconds = 0.5f;
+        clockPeriod.reset();
         for (int i = 0; i < 3; ++i) {
             tracks[i].reset();
         }
@@ -417,23 +354,13 @@ struct EuclideanRhythm : Module {
             return;
         }
         
-        if (globalClockTriggered) {
-            if (secondsSinceLastClock > 0.0f) {
-                globalClockSeconds = secondsSinceLastClock;
-                globalClockSeconds = clamp(globalClockSeconds, 0.01f, 10.0f);
-            }
-            secondsSinceLastClock = 0.0f;
-        }
-        
-        if (secondsSinceLastClock >= 0.0f) {
-            secondsSinceLastClock += args.sampleTime;
-        }
+        clockPeriod.process(globalClockTriggered, args.sampleRate);
 
         for (int i = 0; i < 3; ++i) {
             TrackState& track = tracks[i];
             
             int divMultParam = (int)std::round(params[TRACK1_DIVMULT_PARAM + i * 7].getValue());
-            track.updateDivMult(divMultParam);
+            track.clockDivMult.setDivMult(divMultParam);
 
             float lengthParam = params[TRACK1_LENGTH_PARAM + i * 7].getValue();
             float lengthCV = 0.0f;
@@ -462,7 +389,7 @@ struct EuclideanRhythm : Module {
 
             generateEuclideanRhythm(track.pattern, track.length, track.fill, track.shift);
 
-            bool trackClockTrigger = track.processClockDivMult(globalClockTriggered, globalClockSeconds, args.sampleTime);
+            bool trackClockTrigger = track.clockDivMult.process(globalClockTriggered, clockPeriod.period(args.sampleRate), args.sampleRate);
 
             if (trackClockTrigger && globalClockActive) {
                 track.stepTrack();
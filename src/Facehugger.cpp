@@ -1,110 +1,9 @@
 #include "plugin.hpp"
+#include "GrainEngine.hpp"
+#include "LorenzChaos.hpp"
 
-// ChaosGenerator - Lorenz Attractor (same as EllenRipley)
-struct FacehuggerChaosGenerator {
-    float x = 0.1f, y = 0.1f, z = 0.1f;
-
-    void reset() { x = 0.1f; y = 0.1f; z = 0.1f; }
-
-    float process(float rate) {
-        float dt = rate * 0.001f;
-        float dx = 7.5f * (y - x);
-        float dy = x * (30.9f - z) - y;
-        float dz = x * y - 1.02f * z;
-        x += dx * dt; y += dy * dt; z += dz * dt;
-        if (std::isnan(x) || std::isnan(y) || std::isnan(z) ||
-            std::abs(x) > 100.0f || std::abs(y) > 100.0f || std::abs(z) > 100.0f) {
-            reset();
-        }
-        return clamp(x * 0.1f, -1.0f, 1.0f);
-    }
-};
-
-// GrainProcessor - 16 Grains (same as EllenRipley)
-struct FacehuggerGrainProcessor {
-    static constexpr int GRAIN_BUFFER_SIZE = 8192;
-    float grainBuffer[GRAIN_BUFFER_SIZE] = {};
-    int grainWriteIndex = 0;
-
-    struct Grain {
-        bool active = false;
-        float position = 0.0f;
-        float size = 0.0f;
-        float envelope = 0.0f;
-        float direction = 1.0f;
-        float pitch = 1.0f;
-    };
-
-    static constexpr int MAX_GRAINS = 16;
-    Grain grains[MAX_GRAINS];
-    float phase = 0.0f;
-
-    void reset() {
-        for (int i = 0; i < GRAIN_BUFFER_SIZE; i++) grainBuffer[i] = 0.0f;
-        grainWriteIndex = 0;
-        for (int i = 0; i < MAX_GRAINS; i++) grains[i].active = false;
-        phase = 0.0f;
-    }
-
-    float process(float input, float grainSize, float density, float position,
-                  bool chaosEnabled, float chaosOutput, float sampleRate) {
-        grainBuffer[grainWriteIndex] = input;
-        grainWriteIndex = (grainWriteIndex + 1) % GRAIN_BUFFER_SIZE;
-
-        float grainSizeMs = grainSize * 99.0f + 1.0f;
-        float grainSamples = (grainSizeMs / 1000.0f) * sampleRate;
-
-        float densityValue = density;
-        if (chaosEnabled) densityValue += chaosOutput * 0.3f;
-        densityValue = clamp(densityValue, 0.0f, 1.0f);
-
-        float triggerRate = densityValue * 50.0f + 1.0f;
-        phase += triggerRate / sampleRate;
-
-        if (phase >= 1.0f) {
-            phase -= 1.0f;
-            for (int i = 0; i < MAX_GRAINS; i++) {
-                if (!grains[i].active) {
-                    grains[i].active = true;
-                    grains[i].size = grainSamples;
-                    grains[i].envelope = 0.0f;
-                    float pos = position;
-                    if (chaosEnabled) {
-                        pos += chaosOutput * 20.0f;
-                        grains[i].direction = (random::uniform() < 0.3f) ? -1.0f : 1.0f;
-                        grains[i].pitch = (densityValue > 0.7f && random::uniform() < 0.2f)
-                            ? (random::uniform() < 0.5f ? 0.5f : 2.0f) : 1.0f;
-                    } else {
-                        grains[i].direction = 1.0f;
-                        grains[i].pitch = 1.0f;
-                    }
-                    pos = clamp(pos, 0.0f, 1.0f);
-                    grains[i].position = pos * GRAIN_BUFFER_SIZE;
-                    break;
-                }
-            }
-        }
-
-        float output = 0.0f;
-        int activeGrains = 0;
-        for (int i = 0; i < MAX_GRAINS; i++) {
-            if (grains[i].active) {
-                float envPhase = grains[i].envelope / grains[i].size;
-                if (envPhase >= 1.0f) { grains[i].active = false; continue; }
-                float env = 0.5f * (1.0f - cos(envPhase * 2.0f * M_PI));
-                int readPos = ((int)grains[i].position % GRAIN_BUFFER_SIZE + GRAIN_BUFFER_SIZE) % GRAIN_BUFFER_SIZE;
-                output += grainBuffer[readPos] * env;
-                grains[i].position += grains[i].direction * grains[i].pitch;
-                while (grains[i].position >= GRAIN_BUFFER_SIZE) grains[i].position -= GRAIN_BUFFER_SIZE;
-                while (grains[i].position < 0) grains[i].position += GRAIN_BUFFER_SIZE;
-                grains[i].envelope += 1.0f;
-                activeGrains++;
-            }
-        }
-        if (activeGrains > 0) output /= sqrt((float)activeGrains);
-        return output;
-    }
-};
+// GrainProcessor - same engine as EllenRipley, up to 64 grains
+using FacehuggerGrainProcessor = granular::GrainEngine<8192, 64>;
 
 struct Facehugger : Module {
     enum ParamIds {
@@ -124,7 +23,7 @@ struct Facehugger : Module {
     };
     enum LightIds { NUM_LIGHTS };
 
-    FacehuggerChaosGenerator chaosGen;
+    chaos::Lorenz chaosGen;
     FacehuggerGrainProcessor leftGrainProcessor;
     FacehuggerGrainProcessor rightGrainProcessor;
     float lastSHValue = 0.0f;
@@ -0,0 +1,122 @@
+#pragma once
+#include "plugin.hpp"
+#include <cstdint>
+#include <cstring>
+
+// Drop-in replacements for the per-sample transcendental calls in the
+// oscillators, shapers and pitch paths. Every function has a scalar and a
+// float_4 version built on the same approximation, so a module can be
+// vectorized later without its sound moving. Maximum errors, measured
+// against the double-precision std:: functions:
+//
+//   sin2pi, cos2pi   2048-point table, linear     abs 1.3e-6 for phase in [0, 1]
+//   sin, cos         via sin2pi, radians          abs 3.5e-6 for |x| < 40
+//   tanh             [7/6] Pade, clamped          abs 9.6e-5, any x
+//   exp2             degree-5 Chebyshev fit       rel 1.8e-7 on [-126, 126]
+//   exp              via exp2                     rel 6.1e-7 on [-10, 10]
+//
+// Away from those ranges the error is set by float rounding of the
+// argument (a phase of 27 cycles is only resolved to 2e-6), not by the
+// approximations. src/tests/FastMathTest.cpp sweeps these ranges and fails
+// if any bound is exceeded.
+//
+// Modules opt in call by call; this file is the one place to trade
+// accuracy for speed.
+namespace fastmath {
+
+using rack::simd::float_4;
+using rack::simd::int32_4;
+
+static constexpr int SINE_SIZE = 2048;
+
+struct SineTable {
+    float values[SINE_SIZE + 1];  // one cycle, with a guard point at the end
+
+    SineTable() {
+        for (int i = 0; i <= SINE_SIZE; i++)
+            values[i] = (float)std::sin(2.0 * M_PI * i / SINE_SIZE);
+    }
+};
+
+inline const SineTable& sineTable() {
+    static const SineTable instance;
+    return instance;
+}
+
+// sin(2 pi phase), phase in cycles and not limited to 0..1
+inline float sin2pi(float phase) {
+    float x = (phase - std::floor(phase)) * SINE_SIZE;
+    int i = std::min((int)x, SINE_SIZE - 1);
+    const float* v = sineTable().values;
+    return v[i] + (v[i + 1] - v[i]) * (x - i);
+}
+
+inline float_4 sin2pi(float_4 phase) {
+    float_4 x = (phase - rack::simd::floor(phase)) * (float)SINE_SIZE;
+    float_4 xFloor = rack::simd::floor(x);
+    const float* v = sineTable().values;
+    float_4 a, b;
+    for (int lane = 0; lane < 4; lane++) {
+        int i = std::min((int)xFloor[lane], SINE_SIZE - 1);
+        a[lane] = v[i];
+        b[lane] = v[i + 1];
+    }
+    return a + (b - a) * (x - xFloor);
+}
+
+template <typename T>
+inline T cos2pi(T phase) {
+    return sin2pi(phase + 0.25f);
+}
+
+template <typename T>
+inline T sin(T radians) {
+    return sin2pi(radians * (float)(0.5 / M_PI));
+}
+
+template <typename T>
+inline T cos(T radians) {
+    return sin2pi(radians * (float)(0.5 / M_PI) + 0.25f);
+}
+
+// [7/6] Pade approximant of tanh. The clamp sits where it reaches 1, so
+// it stays monotonic and bounded for any input.
+template <typename T>
+inline T tanh(T x) {
+    x = rack::simd::fmin(rack::simd::fmax(x, T(-4.97f)), T(4.97f));
+    T x2 = x * x;
+    T num = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    T den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+    return rack::simd::fmin(rack::simd::fmax(num / den, T(-1.0f)), T(1.0f));
+}
+
+// 2^f for f in [0, 1), fitted at Chebyshev nodes
+template <typename T>
+inline T exp2Fraction(T f) {
+    return 0.99999990f + f * (0.69315449f + f * (0.24014182f + f * (0.055860337f + f * (0.0089495904f + f * 0.0018937541f))));
+}
+
+// 2^x, the integer part goes straight into the exponent bits
+inline float exp2(float x) {
+    x = std::min(std::max(x, -126.0f), 126.0f);
+    float xFloor = std::floor(x);
+    int32_t bits = ((int32_t)xFloor + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return exp2Fraction(x - xFloor) * scale;
+}
+
+inline float_4 exp2(float_4 x) {
+    x = rack::simd::fmin(rack::simd::fmax(x, float_4(-126.0f)), float_4(126.0f));
+    float_4 xFloor = rack::simd::floor(x);
+    int32_4 bits = (int32_4(xFloor) + 127) << 23;
+    float_4 scale = _mm_castsi128_ps(bits.v);
+    return exp2Fraction(x - xFloor) * scale;
+}
+
+template <typename T>
+inline T exp(T x) {
+    return fastmath::exp2(x * (float)M_LOG2E);
+}
+
+} // namespace fastmath
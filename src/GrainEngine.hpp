@@ -0,0 +1,183 @@
+#pragma once
+#include "plugin.hpp"
+#include <cstdint>
+
+// Granular engine shared by EllenRipley and Facehugger. Grain state is kept
+// as structure-of-arrays so four grains advance per float_4, and only groups
+// holding live grains are visited, so a high grain limit costs nothing until
+// it is used. The Hann window comes from a table, buffer reads are linearly
+// interpolated from a power-of-two ring and the 1/sqrt(n) normalization is
+// precomputed.
+namespace granular {
+
+using rack::simd::float_4;
+
+static constexpr int WINDOW_SIZE = 1024;
+
+struct Tables {
+    float window[WINDOW_SIZE + 2];  // Hann, with guard points past the end
+    float_4 laneMasks[16];          // lane n set when bit n is set
+    int laneCounts[16];
+
+    Tables() {
+        for (int i = 0; i < WINDOW_SIZE + 2; i++) {
+            float phase = (float)std::min(i, WINDOW_SIZE) / WINDOW_SIZE;
+            window[i] = 0.5f * (1.0f - std::cos(2.0f * (float)M_PI * phase));
+        }
+        for (int bits = 0; bits < 16; bits++) {
+            float_4 set((float)(bits & 1), (float)(bits & 2), (float)(bits & 4), (float)(bits & 8));
+            laneMasks[bits] = set > float_4(0.f);
+            laneCounts[bits] = (bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1);
+        }
+    }
+};
+
+inline const Tables& tables() {
+    static const Tables instance;
+    return instance;
+}
+
+template <int BUFFER_SIZE, int MAX_GRAINS>
+struct GrainEngine {
+    static_assert((BUFFER_SIZE & (BUFFER_SIZE - 1)) == 0, "grain buffer size must be a power of two");
+    static_assert(MAX_GRAINS % 4 == 0, "grains are processed four at a time");
+    static constexpr int BUFFER_MASK = BUFFER_SIZE - 1;
+    static constexpr int GROUPS = MAX_GRAINS / 4;
+
+    float buffer[BUFFER_SIZE] = {};
+    int writeIndex = 0;
+
+    float_4 position[GROUPS];     // read position in samples
+    float_4 speed[GROUPS];        // direction * pitch
+    float_4 windowPhase[GROUPS];  // runs from 0 to WINDOW_SIZE over the grain
+    float_4 windowStep[GROUPS];
+    int activeBits[GROUPS] = {};  // bit n set while lane n is playing
+
+    float phase = 0.0f;
+    uint32_t rngState = 1;
+    float normalize[MAX_GRAINS + 1];
+    const Tables* shared = &tables();
+
+    GrainEngine() {
+        for (int g = 0; g < GROUPS; g++) {
+            position[g] = 0.f;
+            speed[g] = 1.f;
+            windowPhase[g] = 0.f;
+            windowStep[g] = 0.f;
+        }
+        normalize[0] = 0.f;
+        for (int n = 1; n <= MAX_GRAINS; n++)
+            normalize[n] = 1.0f / std::sqrt((float)n);
+        // Every engine gets its own sequence, so instances and the L/R pair
+        // of one module scatter their grains independently
+        seed(rack::random::u32());
+    }
+
+    void seed(uint32_t s) {
+        rngState = s ? s : 0x9e3779b9u;  // xorshift is stuck at zero
+    }
+
+    void reset() {
+        for (int i = 0; i < BUFFER_SIZE; i++)
+            buffer[i] = 0.0f;
+        writeIndex = 0;
+        for (int g = 0; g < GROUPS; g++)
+            activeBits[g] = 0;
+        phase = 0.0f;
+    }
+
+    float process(float input, float grainSize, float density, float position01,
+                  bool chaosEnabled, float chaosOutput, float sampleRate) {
+        buffer[writeIndex] = input;
+        writeIndex = (writeIndex + 1) & BUFFER_MASK;
+
+        float densityValue = density;
+        if (chaosEnabled) densityValue += chaosOutput * 0.3f;
+        densityValue = clamp(densityValue, 0.0f, 1.0f);
+
+        float triggerRate = densityValue * 50.0f + 1.0f;
+        phase += triggerRate / sampleRate;
+        if (phase >= 1.0f) {
+            phase -= 1.0f;
+            float grainSamples = (grainSize * 99.0f + 1.0f) / 1000.0f * sampleRate;
+            spawn(grainSamples, densityValue, position01, chaosEnabled, chaosOutput);
+        }
+
+        float_4 sum = 0.f;
+        int activeGrains = 0;
+        for (int g = 0; g < GROUPS; g++) {
+            if (!activeBits[g])
+                continue;
+            // Grains whose window has run out stop before producing output
+            float_4 wp = windowPhase[g];
+            int live = activeBits[g] & ~rack::simd::movemask(wp >= float_4((float)WINDOW_SIZE));
+            activeBits[g] = live;
+            if (!live)
+                continue;
+            activeGrains += shared->laneCounts[live];
+
+            float_4 p = position[g];
+            float_4 wFloor = rack::simd::floor(wp);
+            float_4 pFloor = rack::simd::floor(p);
+            float_4 w0, w1, b0, b1;
+            for (int lane = 0; lane < 4; lane++) {
+                int wi = std::min((int)wFloor[lane], WINDOW_SIZE);
+                w0[lane] = shared->window[wi];
+                w1[lane] = shared->window[wi + 1];
+                int bi = (int)pFloor[lane] & BUFFER_MASK;
+                b0[lane] = buffer[bi];
+                b1[lane] = buffer[(bi + 1) & BUFFER_MASK];
+            }
+            float_4 env = w0 + (w1 - w0) * (wp - wFloor);
+            float_4 sample = b0 + (b1 - b0) * (p - pFloor);
+            sum += (env * sample) & shared->laneMasks[live];
+
+            float_4 next = p + speed[g];
+            next = rack::simd::ifelse(next >= float_4((float)BUFFER_SIZE), next - (float)BUFFER_SIZE, next);
+            next = rack::simd::ifelse(next < float_4(0.f), next + (float)BUFFER_SIZE, next);
+            position[g] = next;
+            windowPhase[g] = wp + windowStep[g];
+        }
+
+        return (sum[0] + sum[1] + sum[2] + sum[3]) * normalize[activeGrains];
+    }
+
+private:
+    // xorshift32, cheap enough to call per spawned grain
+    float uniform() {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 17;
+        rngState ^= rngState << 5;
+        return (rngState >> 8) * (1.0f / 16777216.0f);
+    }
+
+    void spawn(float grainSamples, float densityValue, float position01, bool chaosEnabled, float chaosOutput) {
+        for (int g = 0; g < GROUPS; g++) {
+            if (activeBits[g] == 0xF)
+                continue;
+            int lane = 0;
+            while (activeBits[g] & (1 << lane))
+                lane++;
+
+            float pos = position01;
+            float direction = 1.0f;
+            float pitch = 1.0f;
+            if (chaosEnabled) {
+                pos += chaosOutput * 20.0f;
+                direction = (uniform() < 0.3f) ? -1.0f : 1.0f;
+                if (densityValue > 0.7f && uniform() < 0.2f)
+                    pitch = uniform() < 0.5f ? 0.5f : 2.0f;
+            }
+            pos = clamp(pos, 0.0f, 1.0f);
+
+            position[g][lane] = pos * BUFFER_SIZE;
+            speed[g][lane] = direction * pitch;
+            windowPhase[g][lane] = 0.0f;
+            windowStep[g][lane] = WINDOW_SIZE / grainSamples;
+            activeBits[g] |= 1 << lane;
+            return;
+        }
+    }
+};
+
+} // namespace granular
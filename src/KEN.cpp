@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "SilenceGate.hpp"
 struct KEN : Module {
 
     enum ParamId {
@@ -56,6 +57,8 @@ struct KEN : Module {
     dsp::TBiquadFilter<> elevationFilters[8][2];
     dsp::TBiquadFilter<> reverbFilters[8][2];
 
+    silence::Gate silenceGate;
+
     KEN() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
 
@@ -270,9 +273,21 @@ struct KEN : Module {
     }
 
     void process(const ProcessArgs& args) override {
+        // The HRTF graph sleeps once every input and the filter tails are silent
+        float inputLevel = 0.0f;
+        for (int i = 0; i < 8; i++) {
+            inputLevel = std::max(inputLevel, std::abs(inputs[INPUT_1 + i].getVoltage()));
+        }
+        if (!silenceGate.wake(inputLevel)) {
+            outputs[LEFT_OUTPUT].setVoltage(0.0f);
+            outputs[RIGHT_OUTPUT].setVoltage(0.0f);
+            return;
+        }
+
         float level = params[LEVEL_PARAM].getValue();
         float leftOut = 0.0f;
         float rightOut = 0.0f;
+        float tailLevel = 0.0f;
 
         for (int i = 0; i < 8; i++) {
             if (inputs[INPUT_1 + i].isConnected()) {
@@ -295,6 +310,7 @@ struct KEN : Module {
 
                 delayedLeft = delayedLeft * (1.0f - reverbMix) + reverbLeft * reverbMix;
                 delayedRight = delayedRight * (1.0f - reverbMix) + reverbRight * reverbMix;
+                tailLevel = std::max({tailLevel, std::abs(delayedLeft), std::abs(delayedRight)});
 
                 float smoothing = 0.001f;
                 smoothedGains[i][0] = smoothedGains[i][0] * (1.0f - smoothing) + hrtfGains[i][0] * smoothing;
@@ -305,6 +321,8 @@ struct KEN : Module {
             }
         }
 
+        silenceGate.track(std::max(inputLevel, tailLevel), args.sampleRate);
+
         outputs[LEFT_OUTPUT].setVoltage(leftOut);
         outputs[RIGHT_OUTPUT].setVoltage(rightOut);
     }
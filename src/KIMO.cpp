@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "FastMath.hpp"
 
 struct KimoAccentParamQuantity : ParamQuantity {
     std::string getDisplayValueString() override {
@@ -164,7 +165,7 @@ struct BasicSineVCO {
     }
     
     float process(float freq_hz, float fm_cv, float saturation = 1.0f) {
-        float modulated_freq = freq_hz * std::pow(2.0f, fm_cv);
+        float modulated_freq = freq_hz * fastmath::exp2(fm_cv);
         modulated_freq = clamp(modulated_freq, 1.0f, sampleRate * 0.45f);
         
         float delta_phase = modulated_freq / sampleRate;
@@ -174,10 +175,10 @@ struct BasicSineVCO {
             phase -= 1.0f;
         }
         
-        float sine_wave = std::sin(2.0f * M_PI * phase);
+        float sine_wave = fastmath::sin2pi(phase);
         
         if (saturation > 1.0f) {
-            sine_wave = std::tanh(sine_wave * saturation) / std::tanh(saturation);
+            sine_wave = fastmath::tanh(sine_wave * saturation) / fastmath::tanh(saturation);
         }
         
         return sine_wave * 5.0f;
@@ -380,7 +381,7 @@ struct KIMO : Module {
             track.stepTrack();
         }
         
-        float decayParam = std::exp(params[DECAY_PARAM].getValue());
+        float decayParam = fastmath::exp(params[DECAY_PARAM].getValue());
         if (inputs[DECAY_CV_INPUT].isConnected()) {
             decayParam += inputs[DECAY_CV_INPUT].getVoltage() / 10.0f;
             decayParam = clamp(decayParam, 0.01f, 2.0f);
@@ -396,11 +397,11 @@ struct KIMO : Module {
             fmAmount = clamp(fmAmount, 0.0f, 1.0f);
         }
         
-        float freqParam = std::pow(2.0f, params[TUNE_PARAM].getValue());
+        float freqParam = fastmath::exp2(params[TUNE_PARAM].getValue());
         if (inputs[TUNE_CV_INPUT].isConnected()) {
             float freqCV = params[TUNE_PARAM].getValue() + inputs[TUNE_CV_INPUT].getVoltage();
-            freqParam = std::pow(2.0f, freqCV);
-            freqParam = clamp(freqParam, std::pow(2.0f, std::log2(24.0f)), std::pow(2.0f, std::log2(500.0f)));
+            freqParam = fastmath::exp2(freqCV);
+            freqParam = clamp(freqParam, 24.0f, 500.0f);
         }
         
         float punchAmount = params[PUNCH_PARAM].getValue();
@@ -1,4 +1,6 @@
 #include "plugin.hpp"
+#include <atomic>
+#include "SampleStore.hpp"
 // Industrial color scheme
 namespace LaunchpadColors {
     static const NVGcolor EMPTY = nvgRGB(50, 52, 55);
@@ -16,7 +18,11 @@ namespace LaunchpadColors {
 
 // Maximum recording length in samples (10 seconds at 48kHz)
 static constexpr int MAX_BUFFER_SIZE = 48000 * 10;
-static constexpr int MAX_WAVEFORM_WIDTH = 64;  // Max display width for waveform cache
+
+// Cell audio storage: 16-bit over the +-12 V rail halves the footprint of
+// the 64 cells (about 61 MB instead of 123 MB) at 0.4 mV resolution
+using CellBuffer = sampling::Int16Store<MAX_BUFFER_SIZE>;
+static constexpr int MIX_BLOCK = 16;          // Samples rendered and mixed at a time, multiple of 4
 
 // Cell state enum
 enum CellState {
@@ -28,63 +34,143 @@ enum CellState {
     CELL_STOP_QUEUED  // Waiting for quantize boundary to stop
 };
 
+// Min/max peak mipmap for the cell waveform. Level 0 holds one pair per
+// PEAK_BLOCK samples and each level above halves the count, so any span
+// is covered by O(levels) entries plus at most two partial blocks read
+// from the buffer. Recording folds in one block at a time.
+struct WaveformPeaks {
+    static constexpr int PEAK_BLOCK = 128;
+    static constexpr int LEVEL0_SIZE = (MAX_BUFFER_SIZE + PEAK_BLOCK - 1) / PEAK_BLOCK;
+    static constexpr int LEVELS = 13;  // 3750 blocks halve down to 1
+    static constexpr int STORAGE = 2 * LEVEL0_SIZE + LEVELS;
+
+    float minPeaks[STORAGE];
+    float maxPeaks[STORAGE];
+    int levelOffset[LEVELS];
+    int blocks = 0;  // complete level 0 blocks
+
+    WaveformPeaks() {
+        int offset = 0;
+        int size = LEVEL0_SIZE;
+        for (int level = 0; level < LEVELS; level++) {
+            levelOffset[level] = offset;
+            offset += size;
+            size = (size + 1) / 2;
+        }
+    }
+
+    void clear() {
+        blocks = 0;
+    }
+
+    // Call after writing sample `length - 1`; folds in the block it completes
+    template <typename Buffer>
+    void append(const Buffer& buffer, int length) {
+        if (length % PEAK_BLOCK != 0) return;
+        int block = length / PEAK_BLOCK - 1;
+        float samples[PEAK_BLOCK];
+        buffer.readBlock(block * PEAK_BLOCK, PEAK_BLOCK, samples);
+        float lo = samples[0], hi = lo;
+        for (int i = 1; i < PEAK_BLOCK; i++) {
+            lo = std::min(lo, samples[i]);
+            hi = std::max(hi, samples[i]);
+        }
+        minPeaks[block] = lo;
+        maxPeaks[block] = hi;
+        blocks = block + 1;
+
+        // Refresh the ancestors; a parent with only one child so far copies it
+        int count = blocks;
+        for (int level = 1; level < LEVELS; level++) {
+            int child = levelOffset[level - 1] + (block & ~1);
+            lo = minPeaks[child];
+            hi = maxPeaks[child];
+            if ((block | 1) < count) {
+                lo = std::min(lo, minPeaks[child + 1]);
+                hi = std::max(hi, maxPeaks[child + 1]);
+            }
+            block >>= 1;
+            count = (count + 1) / 2;
+            minPeaks[levelOffset[level] + block] = lo;
+            maxPeaks[levelOffset[level] + block] = hi;
+        }
+    }
+
+    // Whole-buffer rebuild, for loading a patch
+    template <typename Buffer>
+    void rebuild(const Buffer& buffer, int length) {
+        clear();
+        for (int end = PEAK_BLOCK; end <= length; end += PEAK_BLOCK) {
+            append(buffer, end);
+        }
+    }
+
+    // Min and max of buffer[begin, end)
+    template <typename Buffer>
+    void range(const Buffer& buffer, int begin, int end, float& lo, float& hi) const {
+        lo = INFINITY;
+        hi = -INFINITY;
+        // Ragged edges and anything past the last complete block come from the buffer
+        int alignedBegin = std::min((begin + PEAK_BLOCK - 1) / PEAK_BLOCK * PEAK_BLOCK, end);
+        int alignedEnd = std::max(std::min(end / PEAK_BLOCK, blocks) * PEAK_BLOCK, alignedBegin);
+        scan(buffer, begin, alignedBegin, lo, hi);
+        scan(buffer, alignedEnd, end, lo, hi);
+        // Bottom-up cover of the complete blocks in between
+        int a = alignedBegin / PEAK_BLOCK;
+        int b = alignedEnd / PEAK_BLOCK;
+        for (int level = 0; a < b; level++) {
+            const int offset = levelOffset[level];
+            if (a & 1) {
+                lo = std::min(lo, minPeaks[offset + a]);
+                hi = std::max(hi, maxPeaks[offset + a]);
+                a++;
+            }
+            if (b & 1) {
+                b--;
+                lo = std::min(lo, minPeaks[offset + b]);
+                hi = std::max(hi, maxPeaks[offset + b]);
+            }
+            a >>= 1;
+            b >>= 1;
+        }
+    }
+
+private:
+    template <typename Buffer>
+    static void scan(const Buffer& buffer, int begin, int end, float& lo, float& hi) {
+        float samples[PEAK_BLOCK];
+        while (begin < end) {
+            int count = std::min(end - begin, PEAK_BLOCK);
+            buffer.readBlock(begin, count, samples);
+            for (int i = 0; i < count; i++) {
+                lo = std::min(lo, samples[i]);
+                hi = std::max(hi, samples[i]);
+            }
+            begin += count;
+        }
+    }
+};
+
 // Cell data structure - MetaModule compatible (fixed arrays, no std::vector)
 struct CellData {
-    float buffer[MAX_BUFFER_SIZE];
+    CellBuffer buffer;
     int recordedLength = 0;  // Actual recorded samples
     int loopClocks = 0;      // Loop length in clocks
     CellState state = CELL_EMPTY;
     int playPosition = 0;
     int recordPosition = 0;
 
-    // Waveform cache for display (downsampled)
-    float waveformCache[MAX_WAVEFORM_WIDTH];
-    int waveformCacheSize = 0;
-    bool waveformDirty = true;
-
-    CellData() {
-        memset(buffer, 0, sizeof(buffer));
-        memset(waveformCache, 0, sizeof(waveformCache));
-    }
+    // Peak mipmap for display
+    WaveformPeaks peaks;
 
     void clear() {
-        memset(buffer, 0, sizeof(buffer));
+        buffer.clear();
         recordedLength = 0;
         loopClocks = 0;
         state = CELL_EMPTY;
         playPosition = 0;
         recordPosition = 0;
-        memset(waveformCache, 0, sizeof(waveformCache));
-        waveformCacheSize = 0;
-        waveformDirty = true;
-    }
-
-    void updateWaveformCache(int displayWidth) {
-        if (displayWidth > MAX_WAVEFORM_WIDTH) displayWidth = MAX_WAVEFORM_WIDTH;
-        if (!waveformDirty && waveformCacheSize == displayWidth) return;
-
-        waveformCacheSize = displayWidth;
-
-        // Use recordPosition during recording, recordedLength otherwise
-        int length = (state == CELL_RECORDING) ? recordPosition : recordedLength;
-
-        if (length == 0) {
-            for (int i = 0; i < displayWidth; i++) {
-                waveformCache[i] = 0.f;
-            }
-            return;
-        }
-
-        // Store actual waveform samples (not envelope)
-        for (int i = 0; i < displayWidth; i++) {
-            int sampleIndex = i * length / displayWidth;
-            if (sampleIndex < recordedLength || (state == CELL_RECORDING && sampleIndex < recordPosition)) {
-                waveformCache[i] = buffer[sampleIndex];
-            } else {
-                waveformCache[i] = 0.f;
-            }
-        }
-        waveformDirty = false;
+        peaks.clear();
     }
 };
 
@@ -186,6 +272,22 @@ struct Launchpad : Module {
     // Quantize values: 0=Free, 1=1, 2=8, 3=16, 4=32, 5=64
     const int quantizeValues[6] = {0, 1, 8, 16, 32, 64};
 
+    // Row engine: the sounding cell of each row is cached and rendered
+    // MIX_BLOCK samples ahead as contiguous spans, then mixed four samples
+    // per float_4. Anything that changes a cell's play state sets
+    // cellsChanged (from either thread), and the rows are re-resolved from
+    // the current sample.
+    std::atomic<bool> cellsChanged{true};
+    int activeCell[8] = {-1, -1, -1, -1, -1, -1, -1, -1};  // -1 = row silent
+    int renderFrom[8] = {};                                 // block offset where the span starts
+    int renderStart[8] = {};                                // play position at that offset
+    int blockIndex = MIX_BLOCK;
+    float rowBlock[8][MIX_BLOCK] = {};
+    float rowLevel[8] = {};
+    simd::float_4 rowGains[8][6];                           // mix L/R, send A L/R, send B L/R
+    enum MixBus { BUS_MIX_L, BUS_MIX_R, BUS_SEND_A_L, BUS_SEND_A_R, BUS_SEND_B_L, BUS_SEND_B_R, NUM_BUSES };
+    float busBlock[NUM_BUSES][MIX_BLOCK] = {};
+
     Launchpad() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
 
@@ -242,6 +344,7 @@ struct Launchpad : Module {
         clockCount = 0;
         recordingRow = -1;
         recordingCol = -1;
+        cellsChanged = true;
     }
 
     // Cell interaction
@@ -269,11 +372,13 @@ struct Launchpad : Module {
                 cell.state = CELL_QUEUED;
             }
         }
+        cellsChanged = true;
     }
 
     void onCellHold(int row, int col) {
         // Clear cell
         cells[row][col].clear();
+        cellsChanged = true;
     }
 
     void startRecording(int row, int col) {
@@ -283,11 +388,11 @@ struct Launchpad : Module {
         }
 
         CellData& cell = cells[row][col];
-        memset(cell.buffer, 0, sizeof(cell.buffer));
+        cell.buffer.clear();
         cell.recordPosition = 0;
         cell.recordedLength = 0;
         cell.state = CELL_RECORDING;
-        cell.waveformDirty = true;
+        cell.peaks.clear();
 
         recordingRow = row;
         recordingCol = col;
@@ -298,11 +403,12 @@ struct Launchpad : Module {
         if (recordingRow < 0) return;
 
         CellData& cell = cells[recordingRow][recordingCol];
+        cell.buffer.flush();
         cell.recordedLength = cell.recordPosition;
         cell.loopClocks = clockCount - recordStartClock;
         if (cell.loopClocks < 1) cell.loopClocks = 1;
         cell.state = cell.recordedLength > 0 ? CELL_HAS_CONTENT : CELL_EMPTY;
-        cell.waveformDirty = true;
+        cellsChanged = true;
 
         recordingRow = -1;
         recordingCol = -1;
@@ -320,6 +426,7 @@ struct Launchpad : Module {
         CellData& cell = cells[row][col];
         cell.state = CELL_PLAYING;
         cell.playPosition = 0;
+        cellsChanged = true;
     }
 
     void stopAll() {
@@ -333,6 +440,7 @@ struct Launchpad : Module {
                 }
             }
         }
+        cellsChanged = true;
     }
 
     void triggerScene(int col) {
@@ -376,6 +484,97 @@ struct Launchpad : Module {
                 }
             }
         }
+        cellsChanged = true;
+    }
+
+    // First cell in the row from `startCol` on that is sounding, -1 if none
+    int findActiveCell(int row, int startCol = 0) {
+        for (int c = startCol; c < 8; c++) {
+            const CellData& cell = cells[row][c];
+            // STOP_QUEUED continues playing until quantize boundary
+            if ((cell.state == CELL_PLAYING || cell.state == CELL_STOP_QUEUED) && cell.recordedLength > 0) {
+                return c;
+            }
+        }
+        return -1;
+    }
+
+    // Fill rowBlock[row][from..] from the active cell, copying whole spans
+    // between loop points. The cell's playPosition stays at `from` until
+    // the block is committed.
+    void renderRow(int row, int from) {
+        int col = activeCell[row];
+        if (col < 0 || cells[row][col].recordedLength <= 0) {
+            memset(rowBlock[row], 0, sizeof(rowBlock[row]));
+            return;
+        }
+        CellData& cell = cells[row][col];
+        int length = cell.recordedLength;
+        int pos = cell.playPosition;
+        if (pos >= length) pos = 0;
+        renderFrom[row] = from;
+        renderStart[row] = pos;
+        int i = from;
+        while (i < MIX_BLOCK) {
+            int span = std::min(MIX_BLOCK - i, length - pos);
+            cell.buffer.readBlock(pos, span, &rowBlock[row][i]);
+            i += span;
+            pos += span;
+            if (pos >= length) pos = 0;  // Loop
+        }
+    }
+
+    // Advance every sounding cell past the finished block
+    void commitBlock() {
+        for (int r = 0; r < 8; r++) {
+            int col = activeCell[r];
+            if (col < 0) continue;
+            CellData& cell = cells[r][col];
+            if (cell.recordedLength <= 0) continue;
+            cell.playPosition = (renderStart[r] + MIX_BLOCK - renderFrom[r]) % cell.recordedLength;
+        }
+    }
+
+    void updateRowGains() {
+        for (int r = 0; r < 8; r++) {
+            float level = params[LEVEL_1_PARAM + r * 4].getValue();
+            float pan = params[PAN_1_PARAM + r * 4].getValue();
+            float panL = (pan <= 0) ? 1.f : (1.f - pan);
+            float panR = (pan >= 0) ? 1.f : (1.f + pan);
+            float sendA = params[SEND_A_1_PARAM + r * 4].getValue();
+            float sendB = params[SEND_B_1_PARAM + r * 4].getValue();
+            float gainL = level * panL;
+            float gainR = level * panR;
+            rowLevel[r] = level;
+            rowGains[r][BUS_MIX_L] = gainL;
+            rowGains[r][BUS_MIX_R] = gainR;
+            rowGains[r][BUS_SEND_A_L] = gainL * sendA;
+            rowGains[r][BUS_SEND_A_R] = gainR * sendA;
+            rowGains[r][BUS_SEND_B_L] = gainL * sendB;
+            rowGains[r][BUS_SEND_B_R] = gainR * sendB;
+        }
+    }
+
+    // Sum the sounding rows into the bus blocks from `from` (rounded down to
+    // a float_4 boundary; samples before it have already been output)
+    void mixBlock(int from) {
+        from &= ~3;
+        for (int i = from; i < MIX_BLOCK; i += 4) {
+            simd::float_4 bus[NUM_BUSES];
+            for (int b = 0; b < NUM_BUSES; b++) {
+                bus[b] = 0.f;
+            }
+            for (int r = 0; r < 8; r++) {
+                if (activeCell[r] < 0) continue;
+                simd::float_4 x = simd::float_4::load(&rowBlock[r][i]);
+                for (int b = 0; b < NUM_BUSES; b++) {
+                    bus[b] += x * rowGains[r][b];
+                }
+            }
+            for (int b = 0; b < NUM_BUSES; b++) {
+                bus[b].store(&busBlock[b][i]);
+            }
+        }
     }
 
     void process(const ProcessArgs& args) override {
@@ -386,9 +585,12 @@ struct Launchpad : Module {
                 for (int c = 0; c < 8; c++) {
                     if (cells[r][c].state == CELL_PLAYING) {
                         cells[r][c].playPosition = 0;
+                        // Forget the rendered span so the row restarts from 0
+                        if (activeCell[r] == c) activeCell[r] = -1;
                     }
                 }
             }
+            cellsChanged = true;
         }
 
         // Process clock
@@ -417,6 +619,7 @@ struct Launchpad : Module {
                         }
                     }
                 }
+                cellsChanged = true;
             }
         }
         samplesSinceLastClock++;
@@ -444,65 +647,54 @@ struct Launchpad : Module {
             float inputVoltage = inputs[ROW_1_INPUT + recordingRow].getVoltage();
 
             if (cell.recordPosition < MAX_BUFFER_SIZE) {
-                cell.buffer[cell.recordPosition++] = inputVoltage;
-                cell.waveformDirty = true;
+                cell.buffer.write(cell.recordPosition++, inputVoltage);
+                cell.peaks.append(cell.buffer, cell.recordPosition);
             } else {
                 // Buffer full, stop recording
                 stopRecording();
             }
         }
 
-        // Mixing
-        float mixL = 0.f, mixR = 0.f;
-        float sendAL = 0.f, sendAR = 0.f;
-        float sendBL = 0.f, sendBR = 0.f;
-
-        for (int r = 0; r < 8; r++) {
-            float rowOutput = 0.f;
+        // Start a new block: advance the cells, render spans, read gains
+        if (blockIndex >= MIX_BLOCK) {
+            commitBlock();
+            blockIndex = 0;
+            for (int r = 0; r < 8; r++) {
+                if (activeCell[r] >= 0) renderRow(r, 0);
+            }
+            updateRowGains();
+            mixBlock(0);
+        }
 
-            // Find playing cell in this row
-            for (int c = 0; c < 8; c++) {
-                CellData& cell = cells[r][c];
-                // STOP_QUEUED continues playing until quantize boundary
-                if ((cell.state == CELL_PLAYING || cell.state == CELL_STOP_QUEUED) && cell.recordedLength > 0) {
-                    rowOutput = cell.buffer[cell.playPosition];
-
-                    // Advance play position
-                    cell.playPosition++;
-                    if (cell.playPosition >= cell.recordedLength) {
-                        cell.playPosition = 0;  // Loop
-                    }
-                    break;  // Session mode: only one cell per row
+        // A cell started or stopped: re-render the rows that changed from here
+        if (cellsChanged.exchange(false)) {
+            bool remix = false;
+            for (int r = 0; r < 8; r++) {
+                int col = findActiveCell(r);
+                if (col == activeCell[r]) continue;
+                // A cell that still plays but is no longer first in the row pauses here
+                int previous = activeCell[r];
+                if (previous >= 0 && findActiveCell(r, previous) == previous) {
+                    CellData& cell = cells[r][previous];
+                    cell.playPosition = (renderStart[r] + blockIndex - renderFrom[r]) % cell.recordedLength;
                 }
+                activeCell[r] = col;
+                renderRow(r, blockIndex);
+                remix = true;
             }
+            if (remix) mixBlock(blockIndex);
+        }
 
-            // Apply level
-            float level = params[LEVEL_1_PARAM + r * 4].getValue();
-            rowOutput *= level;
-
-            // Apply pan
-            float pan = params[PAN_1_PARAM + r * 4].getValue();
-            float panL = (pan <= 0) ? 1.f : (1.f - pan);
-            float panR = (pan >= 0) ? 1.f : (1.f + pan);
-
-            float rowL = rowOutput * panL;
-            float rowR = rowOutput * panR;
-
-            // Send to outputs
-            outputs[ROW_1_OUTPUT + r].setVoltage(rowOutput);
-
-            // Accumulate sends
-            float sendA = params[SEND_A_1_PARAM + r * 4].getValue();
-            float sendB = params[SEND_B_1_PARAM + r * 4].getValue();
-            sendAL += rowL * sendA;
-            sendAR += rowR * sendA;
-            sendBL += rowL * sendB;
-            sendBR += rowR * sendB;
-
-            // Accumulate mix
-            mixL += rowL;
-            mixR += rowR;
+        for (int r = 0; r < 8; r++) {
+            outputs[ROW_1_OUTPUT + r].setVoltage(rowBlock[r][blockIndex] * rowLevel[r]);
         }
+        float mixL = busBlock[BUS_MIX_L][blockIndex];
+        float mixR = busBlock[BUS_MIX_R][blockIndex];
+        float sendAL = busBlock[BUS_SEND_A_L][blockIndex];
+        float sendAR = busBlock[BUS_SEND_A_R][blockIndex];
+        float sendBL = busBlock[BUS_SEND_B_L][blockIndex];
+        float sendBR = busBlock[BUS_SEND_B_R][blockIndex];
+        blockIndex++;
 
         // Add returns to mix
         mixL += inputs[RETURN_A_L_INPUT].getVoltage() + inputs[RETURN_B_L_INPUT].getVoltage();
@@ -534,8 +726,13 @@ struct Launchpad : Module {
                 // Save buffer as base64 or skip if empty
                 if (cell.recordedLength > 0) {
                     json_t* bufferJ = json_array();
-                    for (int i = 0; i < cell.recordedLength; i++) {
-                        json_array_append_new(bufferJ, json_real(cell.buffer[i]));
+                    float samples[WaveformPeaks::PEAK_BLOCK];
+                    for (int begin = 0; begin < cell.recordedLength; begin += WaveformPeaks::PEAK_BLOCK) {
+                        int count = std::min(cell.recordedLength - begin, WaveformPeaks::PEAK_BLOCK);
+                        cell.buffer.readBlock(begin, count, samples);
+                        for (int i = 0; i < count; i++) {
+                            json_array_append_new(bufferJ, json_real(samples[i]));
+                        }
                     }
                     json_object_set_new(cellJ, "buffer", bufferJ);
                 }
@@ -567,19 +764,21 @@ json_t* cellsJ = json_object_get(rootJ, "cells");
 
                     json_t* bufferJ = json_object_get(cellJ, "buffer");
                     if (bufferJ && cell.recordedLength > 0) {
-                        memset(cell.buffer, 0, sizeof(cell.buffer));
+                        cell.buffer.clear();
                         int loadCount = cell.recordedLength;
                         if (loadCount > MAX_BUFFER_SIZE) loadCount = MAX_BUFFER_SIZE;
                         if (loadCount > (int)json_array_size(bufferJ)) loadCount = (int)json_array_size(bufferJ);
                         for (int i = 0; i < loadCount; i++) {
-                            cell.buffer[i] = json_real_value(json_array_get(bufferJ, i));
+                            cell.buffer.write(i, json_real_value(json_array_get(bufferJ, i)));
                         }
+                        cell.buffer.flush();
                         cell.state = CELL_HAS_CONTENT;
-                        cell.waveformDirty = true;
+                        cell.peaks.rebuild(cell.buffer, std::min(cell.recordedLength, MAX_BUFFER_SIZE));
                     }
                 }
             }
         }
+        cellsChanged = true;
     }
 };
 
@@ -693,7 +892,7 @@ void CellWidget::drawWaveform(const DrawArgs& args, CellData& cell) {
     if (length == 0) return;
 
     int displayWidth = (int)box.size.x - 8;
-    cell.updateWaveformCache(displayWidth);
+    if (displayWidth <= 0) return;
 
     // Choose waveform color
     NVGcolor waveColor;
@@ -707,22 +906,28 @@ void CellWidget::drawWaveform(const DrawArgs& args, CellData& cell) {
     float centerY = box.size.y / 2;
     float maxHeight = box.size.y / 2 - 4;  // Leave 4px margin top/bottom
 
-    // Draw actual waveform as connected line (±10V scaling)
+    // Min/max envelope per column from the peak mipmap (±10V scaling)
+    float columnMin[128], columnMax[128];
+    int columns = std::min(displayWidth, 128);
+    for (int i = 0; i < columns; i++) {
+        int begin = (int)((int64_t)i * length / columns);
+        int end = std::max((int)((int64_t)(i + 1) * length / columns), begin + 1);
+        cell.peaks.range(cell.buffer, begin, end, columnMin[i], columnMax[i]);
+    }
+
     nvgBeginPath(args.vg);
-    bool first = true;
-    for (int i = 0; i < displayWidth; i++) {
-        float voltage = cell.waveformCache[i];
-        float y = centerY - (voltage / 10.f) * maxHeight;  // ±10V scaling
-        y = clamp(y, 2.f, box.size.y - 2.f);
-
-        float x = 4 + i;
-        if (first) {
-            nvgMoveTo(args.vg, x, y);
-            first = false;
-        } else {
-            nvgLineTo(args.vg, x, y);
-        }
+    for (int i = 0; i < columns; i++) {
+        float y = clamp(centerY - (columnMax[i] / 10.f) * maxHeight, 2.f, box.size.y - 2.f);
+        if (i == 0) nvgMoveTo(args.vg, 4 + i, y);
+        else nvgLineTo(args.vg, 4 + i, y);
+    }
+    for (int i = columns - 1; i >= 0; i--) {
+        float y = clamp(centerY - (columnMin[i] / 10.f) * maxHeight, 2.f, box.size.y - 2.f);
+        nvgLineTo(args.vg, 4 + i, y);
     }
+    nvgClosePath(args.vg);
+    nvgFillColor(args.vg, waveColor);
+    nvgFill(args.vg);
     nvgStrokeColor(args.vg, waveColor);
     nvgStrokeWidth(args.vg, 1.0f);
     nvgStroke(args.vg);
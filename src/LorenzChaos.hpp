@@ -0,0 +1,96 @@
+#pragma once
+#include <cmath>
+#include <algorithm>
+
+// Lorenz chaos source shared by the Ripley family (EllenRipley, Facehugger,
+// Ovomorph, Runner). The attractor only modulates slow parameters, so it is
+// integrated once per block with RK4 and linearly interpolated in between.
+// Speed matches the old per-sample Euler version: `rate` advances the
+// system by rate * 0.001 model time per sample.
+namespace chaos {
+
+struct Lorenz {
+    static constexpr float SIGMA = 7.5f;
+    static constexpr float RHO = 30.9f;
+    static constexpr float BETA = 1.02f;
+    static constexpr float TIME_PER_SAMPLE = 0.001f;
+    static constexpr float MAX_STEP = 0.05f;  // RK4 substep, well inside its stability region
+    static constexpr float LIMIT = 100.0f;
+    static constexpr int DEFAULT_BLOCK = 32;
+
+    float x = 0.1f, y = 0.1f, z = 0.1f;
+
+    Lorenz() {
+        setBlockSize(DEFAULT_BLOCK);
+    }
+
+    // Samples per integration step
+    void setBlockSize(int samples) {
+        blockSize = std::max(1, samples);
+        invBlockSize = 1.0f / blockSize;
+        phase = 0;
+    }
+
+    void reset() {
+        x = 0.1f;
+        y = 0.1f;
+        z = 0.1f;
+        from = to = output();
+        phase = 0;
+    }
+
+    // Next audio-rate sample in [-1, 1]
+    float process(float rate) {
+        if (phase == 0) {
+            from = to;
+            integrate(blockSize * rate * TIME_PER_SAMPLE);
+            to = output();
+        }
+        float t = (++phase) * invBlockSize;
+        if (phase >= blockSize)
+            phase = 0;
+        return from + (to - from) * t;
+    }
+
+private:
+    int blockSize = DEFAULT_BLOCK;
+    float invBlockSize = 1.0f / DEFAULT_BLOCK;
+    int phase = 0;
+    float from = 0.01f;
+    float to = 0.01f;
+
+    float output() const {
+        return std::min(std::max(x * 0.1f, -1.0f), 1.0f);
+    }
+
+    static void derive(float x, float y, float z, float& dx, float& dy, float& dz) {
+        dx = SIGMA * (y - x);
+        dy = x * (RHO - z) - y;
+        dz = x * y - BETA * z;
+    }
+
+    void integrate(float time) {
+        if (time <= 0.0f)
+            return;
+        int steps = std::max(1, (int)std::ceil(time / MAX_STEP));
+        float h = time / steps;
+        for (int i = 0; i < steps; i++) {
+            float k1x, k1y, k1z, k2x, k2y, k2z, k3x, k3y, k3z, k4x, k4y, k4z;
+            derive(x, y, z, k1x, k1y, k1z);
+            derive(x + 0.5f * h * k1x, y + 0.5f * h * k1y, z + 0.5f * h * k1z, k2x, k2y, k2z);
+            derive(x + 0.5f * h * k2x, y + 0.5f * h * k2y, z + 0.5f * h * k2z, k3x, k3y, k3z);
+            derive(x + h * k3x, y + h * k3y, z + h * k3z, k4x, k4y, k4z);
+            x += h / 6.0f * (k1x + 2.0f * k2x + 2.0f * k3x + k4x);
+            y += h / 6.0f * (k1y + 2.0f * k2y + 2.0f * k3y + k4y);
+            z += h / 6.0f * (k1z + 2.0f * k2z + 2.0f * k3z + k4z);
+        }
+        // Blowup guard, once per block instead of once per sample
+        if (!(std::abs(x) <= LIMIT && std::abs(y) <= LIMIT && std::abs(z) <= LIMIT)) {
+            x = 0.1f;
+            y = 0.1f;
+            z = 0.1f;
+        }
+    }
+};
+
+} // namespace chaos
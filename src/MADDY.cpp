@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "ClockDivMult.hpp"
 
 struct DensityParamQuantity : ParamQuantity {
     std::string getDisplayValueString() override {
@@ -111,16 +112,7 @@ struct MADDY : Module {
     bool isSwingBeat = false;
     
     struct TrackState {
-        int divMultValue = 0;
-        int division = 1;
-        int multiplication = 1;
-        float dividedClockSeconds = 0.5f;
-        float multipliedClockSeconds = 0.5f;
-        float dividedProgressSeconds = 0.0f;
-        float gateSeconds = 0.0f;
-        int dividerCount = 0;
-        bool shouldStep = false;
-        bool prevMultipliedGate = false;
+        divmult::ClockDivMult clockDivMult;
         
         int currentStep = 0;
         int length = 16;
@@ -149,10 +141,7 @@ struct MADDY : Module {
         bool justTriggered = false;
 
         void reset() {
-            dividedProgressSeconds = 0.0f;
-            dividerCount = 0;
-            shouldStep = false;
-            prevMultipliedGate = false;
+            clockDivMult.reset();
             currentStep = 0;
             shift = 0;
             for (int i = 0; i < 32; ++i) {
@@ -186,56 +175,6 @@ struct MADDY : Module {
             return (x - k * x) / denominator;
         }
         
-        void updateDivMult(int divMultParam) {
-            divMultValue = divMultParam;
-            if (divMultValue > 0) {
-                division = 1;
-                multiplication = divMultValue + 1;
-            } else if (divMultValue < 0) {
-                division = -divMultValue + 1;
-                multiplication = 1;
-            } else {
-                division = 1;
-                multiplication = 1;
-            }
-        }
-        
-        bool processClockDivMult(bool globalClock, float globalClockSeconds, float sampleTime) {
-            dividedClockSeconds = globalClockSeconds * (float)division;
-            multipliedClockSeconds = dividedClockSeconds / (float)multiplication;
-            gateSeconds = std::max(0.001f, multipliedClockSeconds * 0.5f);
-            
-            if (globalClock) {
-                if (dividerCount < 1) {
-                    dividedProgressSeconds = 0.0f;
-                } else {
-                    dividedProgressSeconds += sampleTime;
-                }
-                ++dividerCount;
-                if (dividerCount >= division) {
-                    dividerCount = 0;
-                }
-            } else {
-                dividedProgressSeconds += sampleTime;
-            }
-            
-            shouldStep = false;
-            if (dividedProgressSeconds < dividedClockSeconds) {
-                float multipliedProgressSeconds = dividedProgressSeconds / multipliedClockSeconds;
-                multipliedProgressSeconds -= (float)(int)multipliedProgressSeconds;
-                multipliedProgressSeconds *= multipliedClockSeconds;
-                
-                bool currentMultipliedGate = multipliedProgressSeconds <= gateSeconds;
-                
-                if (currentMultipliedGate && !prevMultipliedGate) {
-                    shouldStep = true;
-                }
-                prevMultipliedGate = currentMultipliedGate;
-            }
-            
-            return shouldStep;
-        }
-        
         void stepTrack() {
                currentStep = (currentStep + 1) % length;
                gateState = pattern[currentStep];
@@ -326,7 +265,7 @@ struct MADDY : Module {
         }
         
         int calculateTrackCycleClock(const TrackState& track) {
-            return track.length * track.division / track.multiplication;
+            return track.length * track.clockDivMult.division / track.clockDivMult.multiplication;
         }
         
         float processStep(TrackState tracks[], float sampleTime, bool globalClockTriggered, float decayParam, bool& chainTrigger) {
@@ -371,7 +310,7 @@ struct MADDY : Module {
     };
     ChainedSequence chain12, chain23, chain123;
 
-    float globalClockSeconds = 0.5f;
+    divmult::ClockPeriod clockPeriod;
     bool internalClockTriggered = false;
     bool patternClockTriggered = false;
     
@@ -516,7 +455,7 @@ struct MADDY : Module {
         phase = 0.0f;
         swingPhase = 0.0f;
         isSwingBeat = false;
-        globalClockSeconds = 0.5f;
+        clockPeriod.reset();
         for (int i = 0; i < 3; ++i) {
             tracks[i].reset();
         }
@@ -622,7 +561,7 @@ struct MADDY : Module {
             phase -= phaseThreshold;
             clockPulse.trigger(0.001f);
             internalClockTriggered = true;
-            globalClockSeconds = phaseThreshold / freq;
+            clockPeriod.set(phaseThreshold / freq, args.sampleRate);
             isSwingBeat = !isSwingBeat;
         }
         
@@ -638,7 +577,7 @@ struct MADDY : Module {
             TrackState& track = tracks[i];
             
             int divMultParam = (int)std::round(params[TRACK1_DIVMULT_PARAM + i * 2].getValue());
-            track.updateDivMult(divMultParam);
+            track.clockDivMult.setDivMult(divMultParam);
 
             track.length = globalLength;
 
@@ -648,7 +587,7 @@ struct MADDY : Module {
 
             generateMADDYEuclideanRhythm(track.pattern, track.length, track.fill, track.shift);
 
-            bool trackClockTrigger = track.processClockDivMult(internalClockTriggered, globalClockSeconds, args.sampleTime);
+            bool trackClockTrigger = track.clockDivMult.process(internalClockTriggered, clockPeriod.period(args.sampleRate), args.sampleRate);
 
             if (trackClockTrigger) {
                 track.stepTrack();
@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "ClockDivMult.hpp"
 #include <algorithm>
 
 // NOTE: MADDYPlusEnhancedTextLabel removed for MetaModule compatibility
@@ -624,16 +625,7 @@ struct MADDYPlus : Module {
     bool isSwingBeat = false;
 
     struct TrackState {
-        int divMultValue = 0;
-        int division = 1;
-        int multiplication = 1;
-        float dividedClockSeconds = 0.5f;
-        float multipliedClockSeconds = 0.5f;
-        float dividedProgressSeconds = 0.0f;
-        float gateSeconds = 0.0f;
-        int dividerCount = 0;
-        bool shouldStep = false;
-        bool prevMultipliedGate = false;
+        divmult::ClockDivMult clockDivMult;
 
         int currentStep = 0;
         int length = 16;
@@ -668,10 +660,7 @@ struct MADDYPlus : Module {
         bool justTriggered = false;
 
         void reset() {
-            dividedProgressSeconds = 0.0f;
-            dividerCount = 0;
-            shouldStep = false;
-            prevMultipliedGate = false;
+            clockDivMult.reset();
             currentStep = 0;
             shift = 0;
             for (int i = 0; i < 64; ++i) pattern[i] = false;  // MetaModule fix: Clear fixed array
@@ -704,20 +693,6 @@ struct MADDYPlus : Module {
             return (x - k * x) / denominator;
         }
 
-        void updateDivMult(int divMultParam) {
-            divMultValue = divMultParam;
-            if (divMultValue > 0) {
-                division = 1;
-                multiplication = divMultValue + 1;
-            } else if (divMultValue < 0) {
-                division = -divMultValue + 1;
-                multiplication = 1;
-            } else {
-                division = 1;
-                multiplication = 1;
-            }
-        }
-
         // Only regenerate pattern if parameters changed
         void updatePatternIfNeeded(int newLength, int newFill, int newShift) {
             if (newLength != lastLength || newFill != lastFill || newShift != lastShift) {
@@ -732,42 +707,6 @@ struct MADDYPlus : Module {
             }
         }
 
-        bool processClockDivMult(bool globalClock, float globalClockSeconds, float sampleTime) {
-            dividedClockSeconds = globalClockSeconds * (float)division;
-            multipliedClockSeconds = dividedClockSeconds / (float)multiplication;
-            gateSeconds = std::max(0.001f, multipliedClockSeconds * 0.5f);
-
-            if (globalClock) {
-                if (dividerCount < 1) {
-                    dividedProgressSeconds = 0.0f;
-                } else {
-                    dividedProgressSeconds += sampleTime;
-                }
-                ++dividerCount;
-                if (dividerCount >= division) {
-                    dividerCount = 0;
-                }
-            } else {
-                dividedProgressSeconds += sampleTime;
-            }
-
-            shouldStep = false;
-            if (dividedProgressSeconds < dividedClockSeconds) {
-                float multipliedProgressSeconds = dividedProgressSeconds / multipliedClockSeconds;
-                multipliedProgressSeconds -= (float)(int)multipliedProgressSeconds;
-                multipliedProgressSeconds *= multipliedClockSeconds;
-
-                bool currentMultipliedGate = multipliedProgressSeconds <= gateSeconds;
-
-                if (currentMultipliedGate && !prevMultipliedGate) {
-                    shouldStep = true;
-                }
-                prevMultipliedGate = currentMultipliedGate;
-            }
-
-            return shouldStep;
-        }
-
         void stepTrack() {
                currentStep = (currentStep + 1) % length;
                gateState = (currentStep < patternLength) && pattern[currentStep];  // MetaModule fix: Use patternLength
@@ -846,7 +785,7 @@ struct MADDYPlus : Module {
         }
 
         int calculateTrackCycleClock(const TrackState& track) {
-            return track.length * track.division / track.multiplication;
+            return track.length * track.clockDivMult.division / track.clockDivMult.multiplication;
         }
 
         float processStep(TrackState tracks[], float sampleTime, bool globalClockTriggered, float decayParam, bool& chainTrigger) {
@@ -895,7 +834,7 @@ struct MADDYPlus : Module {
     };
     ChainedSequence chain12, chain23, chain123;
 
-    float globalClockSeconds = 0.5f;
+    divmult::ClockPeriod clockPeriod;
     bool internalClockTriggered = false;
     bool patternClockTriggered = false;
     float sampleRate = 44100.0f;
@@ -1373,7 +1312,7 @@ struct MADDYPlus : Module {
         phase = 0.0f;
         swingPhase = 0.0f;
         isSwingBeat = false;
-        globalClockSeconds = 0.5f;
+        clockPeriod.reset();
         for (int i = 0; i < 3; ++i) {
             tracks[i].reset();
         }
@@ -1512,7 +1451,7 @@ json_t* dataToJson() override {
             phase -= phaseThreshold;
             clockPulse.trigger(0.001f);
             internalClockTriggered = true;
-            globalClockSeconds = phaseThreshold / freq;
+            clockPeriod.set(phaseThreshold / freq, args.sampleRate);
             isSwingBeat = !isSwingBeat;
         }
 
@@ -1528,7 +1467,7 @@ json_t* dataToJson() override {
             TrackState& track = tracks[i];
 
             int divMultParam = (int)std::round(params[TRACK1_DIVMULT_PARAM + i * 2].getValue());
-            track.updateDivMult(divMultParam);
+            track.clockDivMult.setDivMult(divMultParam);
 
             float fillParam = params[TRACK1_FILL_PARAM + i * 2].getValue();
             float fillPercentage = clamp(fillParam, 0.0f, 100.0f);
@@ -1537,7 +1476,7 @@ json_t* dataToJson() override {
             // Only regenerate pattern if parameters changed (PERFORMANCE FIX)
             track.updatePatternIfNeeded(globalLength, newFill, track.shift);
 
-            bool trackClockTrigger = track.processClockDivMult(internalClockTriggered, globalClockSeconds, args.sampleTime);
+            bool trackClockTrigger = track.clockDivMult.process(internalClockTriggered, clockPeriod.period(args.sampleRate), args.sampleRate);
 
             if (trackClockTrigger && track.patternLength > 0) {  // MetaModule fix: Use patternLength
                 track.stepTrack();
@@ -0,0 +1,271 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace Microtuning {
+
+// Scala scale (.scl): degree pitches in cents, the last one being the period
+struct ScalaScale {
+    std::string description;
+    std::vector<double> cents;  // degrees 1..N, cents[N-1] is the period
+};
+
+// Scala keyboard mapping (.kbm)
+struct ScalaMapping {
+    int mapSize = 0;            // 0 = linear mapping
+    int middleNote = 60;        // key that plays degree 0
+    int referenceNote = 69;
+    double referenceFreq = 440.0;
+    int octaveDegree = 0;       // formal octave, 0 = scale period
+    std::vector<int> degrees;   // -1 for unmapped ('x') keys
+};
+
+// Reads the next non-comment line, stripped of surrounding whitespace.
+// Returns false at end of file.
+inline bool readScalaLine(FILE* file, std::string& line) {
+    char buf[512];
+    while (std::fgets(buf, sizeof(buf), file)) {
+        if (buf[0] == '!')
+            continue;
+        line = buf;
+        size_t start = line.find_first_not_of(" \t\r\n");
+        size_t end = line.find_last_not_of(" \t\r\n");
+        line = (start == std::string::npos) ? std::string() : line.substr(start, end - start + 1);
+        return true;
+    }
+    return false;
+}
+
+// Pitch line: cents if it contains a '.', otherwise a ratio "n/d" or integer "n"
+inline bool parseScalaPitch(const std::string& line, double& cents) {
+    std::string token = line.substr(0, line.find_first_of(" \t"));
+    if (token.empty())
+        return false;
+    char* end = nullptr;
+    if (token.find('.') != std::string::npos) {
+        cents = std::strtod(token.c_str(), &end);
+        return end != token.c_str();
+    }
+    long num = std::strtol(token.c_str(), &end, 10);
+    if (end == token.c_str())
+        return false;
+    long den = 1;
+    if (*end == '/') {
+        const char* denStart = end + 1;
+        den = std::strtol(denStart, &end, 10);
+        if (end == denStart)
+            return false;
+    }
+    if (num <= 0 || den <= 0)
+        return false;
+    cents = 1200.0 * std::log2((double)num / (double)den);
+    return true;
+}
+
+inline bool loadScalaScale(const char* path, ScalaScale& scale) {
+    FILE* file = std::fopen(path, "r");
+    if (!file)
+        return false;
+
+    std::string line;
+    bool ok = readScalaLine(file, scale.description) && readScalaLine(file, line);
+    int count = ok ? std::atoi(line.c_str()) : 0;
+    ok = ok && count > 0 && count <= 4096;
+
+    scale.cents.clear();
+    for (int i = 0; ok && i < count; i++) {
+        double cents;
+        ok = readScalaLine(file, line) && parseScalaPitch(line, cents);
+        if (ok)
+            scale.cents.push_back(cents);
+    }
+    std::fclose(file);
+
+    return ok && scale.cents.back() > 0.0;
+}
+
+inline bool loadScalaMapping(const char* path, ScalaMapping& mapping) {
+    FILE* file = std::fopen(path, "r");
+    if (!file)
+        return false;
+
+    std::string line;
+    int header[7] = {};
+    double referenceFreq = 0.0;
+    bool ok = true;
+    for (int i = 0; ok && i < 7; i++) {
+        ok = readScalaLine(file, line);
+        if (ok && i == 5)
+            referenceFreq = std::strtod(line.c_str(), nullptr);
+        else if (ok)
+            header[i] = std::atoi(line.c_str());
+    }
+    // header: size, first note, last note, middle note, reference note, (freq), octave degree
+    ok = ok && header[0] >= 0 && header[0] <= 4096 && referenceFreq > 0.0;
+
+    mapping.degrees.clear();
+    for (int i = 0; ok && i < header[0]; i++) {
+        // Trailing entries may be omitted, which leaves those keys unmapped
+        if (!readScalaLine(file, line) || line.empty() || line[0] == 'x' || line[0] == 'X')
+            mapping.degrees.push_back(-1);
+        else
+            mapping.degrees.push_back(std::atoi(line.c_str()));
+    }
+    std::fclose(file);
+
+    if (!ok)
+        return false;
+    mapping.mapSize = header[0];
+    mapping.middleNote = header[3];
+    mapping.referenceNote = header[4];
+    mapping.referenceFreq = referenceFreq;
+    mapping.octaveDegree = header[6];
+    return true;
+}
+
+// Dense voltage-to-pitch table over one period. Bins are sized so each
+// usually holds at most one decision boundary, making quantizing a floor,
+// one table read and a compare. Scales too dense for MAX_BINS keep every
+// boundary; a bin then lists several and they are scanned in order.
+struct ScalaLookup {
+    struct Bin {
+        int first;       // nearest pitch at the start of the bin
+        int boundaries;  // decision boundaries inside the bin, first..first+boundaries-1
+    };
+
+    static const int MIN_BINS = 64;
+    static const int MAX_BINS = 4096;
+
+    float baseVolts = 0.f;    // voltage of degree 0
+    float periodVolts = 1.f;
+    float binsPerVolt = 1.f;
+    int bins = 0;
+    std::vector<Bin> table;
+    // Pitches within the period plus one wrapped neighbour on each side.
+    // threshold[i] is the offset where the nearest pitch switches from
+    // pitch i to pitch i + 1.
+    std::vector<float> volts;
+    std::vector<int> notes;   // nearest 12-TET note (0-23) for the display
+    std::vector<float> threshold;
+    std::string name;
+
+    // Index of the nearest pitch for an offset within the period
+    int nearest(int bin, float inPeriod) const {
+        const Bin& b = table[bin];
+        int i = b.first;
+        int end = b.first + b.boundaries;
+        while (i < end && inPeriod >= threshold[i])
+            i++;
+        return i;
+    }
+};
+
+// Pitch in volts of scale degree d (any integer), relative to degree 0
+inline double scalaDegreeVolts(const ScalaScale& scale, long d) {
+    long n = (long)scale.cents.size();
+    long periods = d >= 0 ? d / n : -((-d + n - 1) / n);
+    long index = d - periods * n;
+    double cents = periods * scale.cents.back() + (index > 0 ? scale.cents[index - 1] : 0.0);
+    return cents / 1200.0;
+}
+
+// Builds the lookup for a scale, optionally restricted and anchored by a
+// keyboard mapping. Runs off the audio thread.
+inline ScalaLookup* compileScalaLookup(const ScalaScale& scale, const ScalaMapping* mapping) {
+    if (scale.cents.empty())
+        return nullptr;
+
+    long n = (long)scale.cents.size();
+    double period = scale.cents.back() / 1200.0;
+    std::vector<double> pitches;
+    double baseVolts = 0.0;
+
+    if (mapping && mapping->mapSize > 0) {
+        // Mapped degrees repeat every formal octave of the mapping
+        long octaveDegree = mapping->octaveDegree > 0 ? mapping->octaveDegree : n;
+        period = scalaDegreeVolts(scale, octaveDegree);
+        for (int degree : mapping->degrees)
+            if (degree >= 0)
+                pitches.push_back(scalaDegreeVolts(scale, degree));
+
+        long key = mapping->referenceNote - mapping->middleNote;
+        long m = mapping->mapSize;
+        long octaves = key >= 0 ? key / m : -((-key + m - 1) / m);
+        int refDegree = mapping->degrees[key - octaves * m];
+        double refVolts = octaves * period + scalaDegreeVolts(scale, refDegree >= 0 ? refDegree : key - octaves * m);
+        baseVolts = std::log2(mapping->referenceFreq / 261.6256) - refVolts;
+    } else {
+        for (long d = 0; d < n; d++)
+            pitches.push_back(scalaDegreeVolts(scale, d));
+        if (mapping) {
+            long key = mapping->referenceNote - mapping->middleNote;
+            baseVolts = std::log2(mapping->referenceFreq / 261.6256) - scalaDegreeVolts(scale, key);
+        }
+    }
+    if (pitches.empty() || period <= 0.0)
+        return nullptr;
+
+    // Reduce into [0, period), sort and drop duplicates
+    for (double& p : pitches)
+        p -= std::floor(p / period) * period;
+    std::sort(pitches.begin(), pitches.end());
+    pitches.erase(std::unique(pitches.begin(), pitches.end(),
+        [](double a, double b) { return std::fabs(a - b) < 1e-9; }), pitches.end());
+
+    double minGap = period - pitches.back() + pitches.front();
+    for (size_t i = 1; i < pitches.size(); i++)
+        minGap = std::min(minGap, pitches[i] - pitches[i - 1]);
+
+    // Bins at least twice as fine as the smallest step
+    int bins = ScalaLookup::MIN_BINS;
+    while (bins < ScalaLookup::MAX_BINS && period / bins > minGap * 0.5)
+        bins *= 2;
+
+    // Neighbours with wraparound: pitch -1 is the last pitch one period down
+    long count = (long)pitches.size();
+    auto pitchAt = [&](long i) {
+        long wraps = i >= 0 ? i / count : -((-i + count - 1) / count);
+        return pitches[i - wraps * count] + wraps * period;
+    };
+    auto noteOf = [&](double volts) {
+        long semitone = std::lround((baseVolts + volts) * 12.0);
+        return (int)(((semitone % 24) + 24) % 24);
+    };
+
+    ScalaLookup* lookup = new ScalaLookup;
+    lookup->baseVolts = (float)baseVolts;
+    lookup->periodVolts = (float)period;
+    lookup->bins = bins;
+    lookup->binsPerVolt = (float)(bins / period);
+    lookup->table.resize(bins);
+
+    // Entry i holds pitch i - 1, so the wrapped neighbours sit at 0 and count + 1
+    for (long i = -1; i <= count; i++) {
+        lookup->volts.push_back((float)pitchAt(i));
+        lookup->notes.push_back(noteOf(pitchAt(i)));
+        lookup->threshold.push_back(i < count ? (float)((pitchAt(i) + pitchAt(i + 1)) * 0.5) : (float)period);
+    }
+
+    long j = -1;  // nearest pitch at the start of the current bin
+    for (int b = 0; b < bins; b++) {
+        double lo = period * b / bins;
+        double hi = period * (b + 1) / bins;
+        while ((pitchAt(j) + pitchAt(j + 1)) * 0.5 <= lo)
+            j++;
+        long last = j;
+        while (last < count && (pitchAt(last) + pitchAt(last + 1)) * 0.5 < hi)
+            last++;
+
+        ScalaLookup::Bin& bin = lookup->table[b];
+        bin.first = (int)(j + 1);
+        bin.boundaries = (int)(last - j);
+    }
+    return lookup;
+}
+
+} // namespace Microtuning
@@ -1,5 +1,8 @@
 #include "plugin.hpp"
 #include "ChowDSP.hpp"
+#include "SmootherBank.hpp"
+#include "ScopeCapture.hpp"
+#include "FastMath.hpp"
 #include <cmath>
 
 struct NIGOQ : Module {
@@ -54,19 +57,12 @@ struct NIGOQ : Module {
         NUM_LIGHTS
     };
 
-    // Scope display (like Observer)
-    struct ScopePoint {
-        float min = INFINITY;
-        float max = -INFINITY;
-    };
-
+    // Scope display (like Observer): track 0 is FINAL, track 1 is MOD
     static constexpr int SCOPE_BUFFER_SIZE = 256;
-    ScopePoint finalBuffer[SCOPE_BUFFER_SIZE];
-    ScopePoint modBuffer[SCOPE_BUFFER_SIZE];
-    ScopePoint currentFinal;
-    ScopePoint currentMod;
-    int bufferIndex = 0;
-    int frameIndex = 0;
+    static constexpr int SCOPE_FINAL_TRACK = 0;
+    static constexpr int SCOPE_MOD_TRACK = 1;
+    using Scope = scope::ScopeCapture<2, SCOPE_BUFFER_SIZE>;
+    Scope scopeCapture;
 
     dsp::SchmittTrigger scopeTriggers[16];
 
@@ -224,37 +220,20 @@ struct NIGOQ : Module {
 
     TwoPoleLP lpFilter;
 
-    // Parameter smoothing
-    struct SmoothedParam {
-        float value = 0.f;
-        float target = 0.f;
-
-        void setTarget(float newTarget) {
-            target = newTarget;
-        }
-
-        float process() {
-            const float alpha = 0.995f;
-            value = value * alpha + target * (1.f - alpha);
-            return value;
-        }
-
-        void reset(float initValue) {
-            value = initValue;
-            target = initValue;
-        }
+    enum SmoothedIds {
+        SMOOTH_MOD_FREQ,
+        SMOOTH_FINAL_FREQ,
+        SMOOTH_LPF_CUTOFF,
+        SMOOTH_ORDER,
+        SMOOTH_HARMONICS,
+        SMOOTH_WAVE_MORPH,
+        SMOOTH_FM_AMT,
+        SMOOTH_FOLD_AMT,
+        SMOOTH_SYM_AMT,
+        SMOOTH_BASS,
+        NUM_SMOOTHED
     };
-
-    SmoothedParam smoothedModFreq;
-    SmoothedParam smoothedFinalFreq;
-    SmoothedParam smoothedLpfCutoff;
-    SmoothedParam smoothedOrder;
-    SmoothedParam smoothedHarmonics;
-    SmoothedParam smoothedWaveMorph;
-    SmoothedParam smoothedFmAmt;
-    SmoothedParam smoothedFoldAmt;
-    SmoothedParam smoothedSymAmt;
-    SmoothedParam smoothedBass;
+    smoothing::SmootherBank<NUM_SMOOTHED> smoothers;
 
     // Oversampling (ChowDSP, like ChoppingKinky)
     chowdsp::VariableOversampling<6> oversampler;  // 12th order Butterworth
@@ -267,31 +246,31 @@ struct NIGOQ : Module {
         float gain = 1.0f + amount * 11.0f;
         float amplified = input * gain;
 
-        float folded = std::cos(amplified * M_PI * 0.25f);
+        float folded = fastmath::cos2pi(amplified * 0.125f);
 
         if (amount > 0.35f) {
-            float fold2 = std::cos(amplified * M_PI * 0.5f);
+            float fold2 = fastmath::cos2pi(amplified * 0.25f);
             float blend = (amount - 0.35f) / 0.65f;
             blend = blend * blend;
             folded = folded * (1.0f - blend * 0.3f) + fold2 * blend * 0.3f;
         }
 
         if (amount > 0.6f) {
-            float fold3 = std::cos(amplified * M_PI * 0.75f);
+            float fold3 = fastmath::cos2pi(amplified * 0.375f);
             float blend = (amount - 0.6f) / 0.4f;
             blend = blend * blend;
             folded = folded * (1.0f - blend * 0.2f) + fold3 * blend * 0.2f;
         }
 
         if (amount > 0.8f) {
-            float fold4 = std::cos(amplified * M_PI);
+            float fold4 = fastmath::cos2pi(amplified * 0.5f);
             float blend = (amount - 0.8f) / 0.2f;
             blend = blend * blend;
             folded = folded * (1.0f - blend * 0.1f) + fold4 * blend * 0.1f;
         }
 
-        float output = std::tanh(folded);
-        output = std::tanh(output * 1.5f);
+        float output = fastmath::tanh(folded);
+        output = fastmath::tanh(output * 1.5f);
 
         float wetness = amount * amount;
         return input * (1.0f - wetness * 0.8f) + output * (wetness * 0.8f + 0.2f);
@@ -315,7 +294,7 @@ struct NIGOQ : Module {
         output *= compensation;
 
         // Soft clipping
-        output = std::tanh(output * 0.8f) * 1.25f;
+        output = fastmath::tanh(output * 0.8f) * 1.25f;
 
         return output;
     }
@@ -340,7 +319,7 @@ struct NIGOQ : Module {
         if (morphParam <= 0.2f) {
             // Morph between sine and triangle
             float blend = morphParam * 5.f;
-            float sine = std::sin(2.f * M_PI * phase);
+            float sine = fastmath::sin2pi(phase);
             float triangle = 2.f * std::abs(2.f * (phase - std::floor(phase + 0.5f))) - 1.f;
             output = sine * (1.f - blend) + triangle * blend;
         }
@@ -442,16 +421,16 @@ struct NIGOQ : Module {
         configLight(TRIG_LIGHT, "Trigger");
 
         // Initialize smoothed parameters
-        smoothedModFreq.reset(params[MOD_FREQ].getValue());
-        smoothedFinalFreq.reset(params[FINAL_FREQ].getValue());
-        smoothedLpfCutoff.reset(params[LPF_CUTOFF].getValue());
-        smoothedOrder.reset(params[ORDER].getValue());
-        smoothedHarmonics.reset(params[HARMONICS].getValue());
-        smoothedWaveMorph.reset(params[MOD_WAVE].getValue());
-        smoothedFmAmt.reset(params[FM_AMT].getValue());
-        smoothedFoldAmt.reset(params[FOLD_AMT].getValue());
-        smoothedSymAmt.reset(params[AM_AMT].getValue());
-        smoothedBass.reset(params[BASS].getValue());
+        smoothers.reset(SMOOTH_MOD_FREQ, params[MOD_FREQ].getValue());
+        smoothers.reset(SMOOTH_FINAL_FREQ, params[FINAL_FREQ].getValue());
+        smoothers.reset(SMOOTH_LPF_CUTOFF, params[LPF_CUTOFF].getValue());
+        smoothers.reset(SMOOTH_ORDER, params[ORDER].getValue());
+        smoothers.reset(SMOOTH_HARMONICS, params[HARMONICS].getValue());
+        smoothers.reset(SMOOTH_WAVE_MORPH, params[MOD_WAVE].getValue());
+        smoothers.reset(SMOOTH_FM_AMT, params[FM_AMT].getValue());
+        smoothers.reset(SMOOTH_FOLD_AMT, params[FOLD_AMT].getValue());
+        smoothers.reset(SMOOTH_SYM_AMT, params[AM_AMT].getValue());
+        smoothers.reset(SMOOTH_BASS, params[BASS].getValue());
 
         lpFilter.setSampleRate(APP->engine->getSampleRate());
         lpFilter.setCutoff(8000.0f);
@@ -490,27 +469,29 @@ struct NIGOQ : Module {
 
     void process(const ProcessArgs& args) override {
         // Update smoothed parameter targets
-        smoothedModFreq.setTarget(params[MOD_FREQ].getValue());
-        smoothedFinalFreq.setTarget(params[FINAL_FREQ].getValue());
-        smoothedLpfCutoff.setTarget(params[LPF_CUTOFF].getValue());
-        smoothedOrder.setTarget(params[ORDER].getValue());
-        smoothedHarmonics.setTarget(params[HARMONICS].getValue());
-        smoothedWaveMorph.setTarget(params[MOD_WAVE].getValue());
-        smoothedFmAmt.setTarget(params[FM_AMT].getValue());
-        smoothedFoldAmt.setTarget(params[FOLD_AMT].getValue());
-        smoothedSymAmt.setTarget(params[AM_AMT].getValue());
-        smoothedBass.setTarget(params[BASS].getValue());
+        smoothers.setTarget(SMOOTH_MOD_FREQ, params[MOD_FREQ].getValue());
+        smoothers.setTarget(SMOOTH_FINAL_FREQ, params[FINAL_FREQ].getValue());
+        smoothers.setTarget(SMOOTH_LPF_CUTOFF, params[LPF_CUTOFF].getValue());
+        smoothers.setTarget(SMOOTH_ORDER, params[ORDER].getValue());
+        smoothers.setTarget(SMOOTH_HARMONICS, params[HARMONICS].getValue());
+        smoothers.setTarget(SMOOTH_WAVE_MORPH, params[MOD_WAVE].getValue());
+        smoothers.setTarget(SMOOTH_FM_AMT, params[FM_AMT].getValue());
+        smoothers.setTarget(SMOOTH_FOLD_AMT, params[FOLD_AMT].getValue());
+        smoothers.setTarget(SMOOTH_SYM_AMT, params[AM_AMT].getValue());
+        smoothers.setTarget(SMOOTH_BASS, params[BASS].getValue());
+        smoothers.setSampleRate(args.sampleRate);
+        smoothers.process();
 
         // Process smoothed parameters
-        float modFreqKnob = smoothedModFreq.process();
+        float modFreqKnob = smoothers.get(SMOOTH_MOD_FREQ);
         const float kModFreqKnobMin = 0.001f;
         const float kModFreqKnobMax = 6000.0f;
-        float modFreq = kModFreqKnobMin * std::pow(kModFreqKnobMax / kModFreqKnobMin, modFreqKnob);
+        float modFreq = kModFreqKnobMin * fastmath::exp2(modFreqKnob * std::log2(kModFreqKnobMax / kModFreqKnobMin));
 
         // Apply 1V/Oct CV
         if (inputs[MOD_1VOCT].isConnected()) {
             float voct = inputs[MOD_1VOCT].getVoltage();
-            modFreq *= std::pow(2.f, voct);
+            modFreq *= fastmath::exp2(voct);
         }
 
         // Apply FM
@@ -523,7 +504,7 @@ struct NIGOQ : Module {
         modFreq = clamp(modFreq, 0.001f, args.sampleRate / 2.f);
 
         // Get wave morph parameter
-        float waveMorph = smoothedWaveMorph.process();
+        float waveMorph = smoothers.get(SMOOTH_WAVE_MORPH);
         if (inputs[MOD_WAVE_CV].isConnected()) {
             float waveCV = inputs[MOD_WAVE_CV].getVoltage() / 10.f;
             waveMorph = clamp(waveMorph + waveCV, 0.f, 1.f);
@@ -551,7 +532,7 @@ struct NIGOQ : Module {
         float attackTimeKnob = params[ATTACK_TIME].getValue();
         const float kAttackTimeMin = 0.1f / 1000.f;  // 0.1ms in seconds
         const float kAttackTimeMax = 100.f / 1000.f;  // 100ms in seconds
-        attackTime = kAttackTimeMin * std::pow(kAttackTimeMax / kAttackTimeMin, attackTimeKnob);
+        attackTime = kAttackTimeMin * fastmath::exp2(attackTimeKnob * std::log2(kAttackTimeMax / kAttackTimeMin));
 
         // Calculate VCA gains
         float modVcaGain, finalVcaGain;
@@ -593,15 +574,15 @@ struct NIGOQ : Module {
         }
 
         // Get FINAL frequency
-        float finalFreqKnob = smoothedFinalFreq.process();
+        float finalFreqKnob = smoothers.get(SMOOTH_FINAL_FREQ);
         const float kFinalFreqKnobMin = 20.0f;
         const float kFinalFreqKnobMax = 8000.0f;
-        float finalFreq = kFinalFreqKnobMin * std::pow(kFinalFreqKnobMax / kFinalFreqKnobMin, finalFreqKnob);
+        float finalFreq = kFinalFreqKnobMin * fastmath::exp2(finalFreqKnob * std::log2(kFinalFreqKnobMax / kFinalFreqKnobMin));
 
         // Apply 1V/Oct CV
         if (inputs[FINAL_1VOCT].isConnected()) {
             float voct = inputs[FINAL_1VOCT].getVoltage();
-            finalFreq *= std::pow(2.f, voct);
+            finalFreq *= fastmath::exp2(voct);
         }
 
         // Apply external Linear FM
@@ -612,7 +593,7 @@ struct NIGOQ : Module {
         }
 
         // Internal FM amount
-        float fmModAmount = smoothedFmAmt.process();
+        float fmModAmount = smoothers.get(SMOOTH_FM_AMT);
         if (inputs[FM_AMT_CV].isConnected()) {
             float fmAttenuation = params[FM_AMT_ATTEN].getValue();
             float fmCV = inputs[FM_AMT_CV].getVoltage() / 10.f;
@@ -673,9 +654,9 @@ struct NIGOQ : Module {
             finalSignal = clamp(finalSignal, -1.f, 1.f);
         } else {
             // Buchla-style "sine" with harmonics
-            float fundamental = std::sin(2.f * M_PI * finalPhase);
-            float harmonic2 = 0.08f * std::sin(4.f * M_PI * finalPhase);
-            float harmonic3 = 0.05f * std::sin(6.f * M_PI * finalPhase);
+            float fundamental = fastmath::sin2pi(finalPhase);
+            float harmonic2 = 0.08f * fastmath::sin2pi(2.f * finalPhase);
+            float harmonic3 = 0.05f * fastmath::sin2pi(3.f * finalPhase);
             finalSignal = (fundamental + harmonic2 + harmonic3) * 0.92f;
         }
 
@@ -683,7 +664,7 @@ struct NIGOQ : Module {
         float cleanSine = finalSignal;
 
         // Get fold amount
-        float foldAmount = smoothedHarmonics.process();
+        float foldAmount = smoothers.get(SMOOTH_HARMONICS);
         if (inputs[HARMONICS_CV].isConnected()) {
             float foldCV = inputs[HARMONICS_CV].getVoltage() / 10.f;
             foldAmount += foldCV;
@@ -691,7 +672,7 @@ struct NIGOQ : Module {
         }
 
         // TM amount
-        float tmAmount = smoothedFoldAmt.process();
+        float tmAmount = smoothers.get(SMOOTH_FOLD_AMT);
         if (inputs[FOLD_AMT_CV].isConnected()) {
             float tmAttenuation = params[FOLD_AMT_ATTEN].getValue();
             float tmCV = inputs[FOLD_AMT_CV].getVoltage() / 10.f;
@@ -707,14 +688,14 @@ struct NIGOQ : Module {
             foldAmountWithMod = clamp(foldAmountWithMod, 0.f, 1.f);
         }
 
-        float rectifyAmount = smoothedOrder.process();
+        float rectifyAmount = smoothers.get(SMOOTH_ORDER);
         if (inputs[ORDER_CV].isConnected()) {
             float rectifyCV = inputs[ORDER_CV].getVoltage() / 10.f;
             rectifyAmount += rectifyCV;
             rectifyAmount = clamp(rectifyAmount, 0.f, 1.f);
         }
 
-        float rectModAmount = smoothedSymAmt.process();
+        float rectModAmount = smoothers.get(SMOOTH_SYM_AMT);
         if (inputs[AM_AMT_CV].isConnected()) {
             float rectModAttenuation = params[AM_AMT_ATTEN].getValue();
             float rectModCV = inputs[AM_AMT_CV].getVoltage() / 10.f;
@@ -752,15 +733,15 @@ struct NIGOQ : Module {
         }
 
         // LPF cutoff
-        float lpfCutoffParam = smoothedLpfCutoff.process();
+        float lpfCutoffParam = smoothers.get(SMOOTH_LPF_CUTOFF);
         const float kLpfCutoffMin = 10.0f;
         const float kLpfCutoffMax = 20000.0f;
-        float lpfCutoff = kLpfCutoffMin * std::pow(kLpfCutoffMax / kLpfCutoffMin, lpfCutoffParam);
+        float lpfCutoff = kLpfCutoffMin * fastmath::exp2(lpfCutoffParam * std::log2(kLpfCutoffMax / kLpfCutoffMin));
 
         if (inputs[LPF_CUTOFF_CV].isConnected()) {
             float lpfCV = inputs[LPF_CUTOFF_CV].getVoltage() / 10.f;
             float cvAmount = lpfCV * 2.f - 1.f;
-            lpfCutoff *= std::pow(2.f, cvAmount * 2.f);
+            lpfCutoff *= fastmath::exp2(cvAmount * 2.f);
         }
 
         lpfCutoff = clamp(lpfCutoff, 20.f, args.sampleRate / 2.f * 0.49f);
@@ -774,7 +755,7 @@ struct NIGOQ : Module {
         float finalSineOutput = cleanSine * 5.f * finalVcaGain;
 
         // Apply BASS knob
-        float bassAmount = smoothedBass.process();
+        float bassAmount = smoothers.get(SMOOTH_BASS);
         if (bassAmount > 0.0f) {
             float cleanSineScaled = finalSineOutput * bassAmount * 2.0f;
             finalOutput = finalOutput + cleanSineScaled;
@@ -783,7 +764,7 @@ struct NIGOQ : Module {
             if (std::abs(finalOutput) > 5.0f) {
                 float sign = finalOutput > 0 ? 1.0f : -1.0f;
                 float excess = std::abs(finalOutput) - 5.0f;
-                finalOutput = sign * (5.0f + std::tanh(excess * 0.3f) * 2.0f);
+                finalOutput = sign * (5.0f + fastmath::tanh(excess * 0.3f) * 2.0f);
             }
         }
 
@@ -797,7 +778,7 @@ struct NIGOQ : Module {
         lights[TRIG_LIGHT].setBrightness(trig ? 1.0f : 0.0f);
 
         // Scope recording (like Observer)
-        if (bufferIndex >= SCOPE_BUFFER_SIZE) {
+        if (!scopeCapture.capturing()) {
             bool triggered = false;
 
             if (!trig) {
@@ -812,30 +793,17 @@ struct NIGOQ : Module {
                 for (int c = 0; c < 16; c++) {
                     scopeTriggers[c].reset();
                 }
-                bufferIndex = 0;
-                frameIndex = 0;
+                scopeCapture.start();
             }
         }
 
-        if (bufferIndex < SCOPE_BUFFER_SIZE) {
-            float deltaTime = dsp::exp2_taylor5(-params[SCOPE_TIME].getValue()) / SCOPE_BUFFER_SIZE;
-            int frameCount = (int) std::ceil(deltaTime * args.sampleRate);
+        if (scopeCapture.capturing()) {
+            scopeCapture.setTime(params[SCOPE_TIME].getValue(), args.sampleRate);
 
             float modSample = modOutputWithVca / 5.0f - 1.0f;  // Convert 0-10V to -1 to 1
             float finalSample = finalOutput / 5.0f;  // Convert ±5V to ±1
-            currentFinal.min = std::min(currentFinal.min, finalSample);
-            currentFinal.max = std::max(currentFinal.max, finalSample);
-            currentMod.min = std::min(currentMod.min, modSample);
-            currentMod.max = std::max(currentMod.max, modSample);
-
-            if (++frameIndex >= frameCount) {
-                frameIndex = 0;
-                finalBuffer[bufferIndex] = currentFinal;
-                modBuffer[bufferIndex] = currentMod;
-                currentFinal = ScopePoint();
-                currentMod = ScopePoint();
-                bufferIndex++;
-            }
+            simd::float_4 samples(finalSample, modSample, 0.f, 0.f);
+            scopeCapture.push(&samples);
         }
     }
 };
@@ -871,7 +839,7 @@ struct NIGOQScopeDisplay : LedDisplay {
         nvgStroke(args.vg);
     }
 
-    void drawWave(const DrawArgs& args, NIGOQ::ScopePoint* buffer, NVGcolor color, float yOffset) {
+    void drawWave(const DrawArgs& args, const NIGOQ::Scope::Frame& frame, int track, NVGcolor color, float yOffset) {
         if (!module) return;
 
         nvgSave(args.vg);
@@ -883,8 +851,7 @@ struct NIGOQScopeDisplay : LedDisplay {
         nvgBeginPath(args.vg);
 
         for (int i = 0; i < NIGOQ::SCOPE_BUFFER_SIZE; i++) {
-            const NIGOQ::ScopePoint& point = buffer[i];
-            float value = point.max;
+            float value = frame.maxAt(track, i);
             if (!std::isfinite(value))
                 value = 0.f;
 
@@ -912,11 +879,13 @@ struct NIGOQScopeDisplay : LedDisplay {
 
         if (!module) return;
 
+        const NIGOQ::Scope::Frame& frame = module->scopeCapture.read();
+
         // Draw FINAL trace (top half, pink)
-        drawWave(args, module->finalBuffer, nvgRGB(255, 133, 133), 0);
+        drawWave(args, frame, NIGOQ::SCOPE_FINAL_TRACK, nvgRGB(255, 133, 133), 0);
 
         // Draw MOD trace (bottom half, cyan)
-        drawWave(args, module->modBuffer, nvgRGB(133, 200, 255), box.size.y / 2.0f);
+        drawWave(args, frame, NIGOQ::SCOPE_MOD_TRACK, nvgRGB(133, 200, 255), box.size.y / 2.0f);
     }
 
     void onDragMove(const event::DragMove& e) override {
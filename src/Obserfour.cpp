@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "ScopeCapture.hpp"
 
 struct Obserfour : Module {
     enum ParamIds {
@@ -25,17 +26,10 @@ struct Obserfour : Module {
         NUM_LIGHTS
     };
 
-    struct ScopePoint {
-        float min = INFINITY;
-        float max = -INFINITY;
-    };
-
     static constexpr int SCOPE_BUFFER_SIZE = 256;
     
-    ScopePoint scopeBuffer[8][SCOPE_BUFFER_SIZE];
-    ScopePoint currentPoint[8];
-    int bufferIndex = 0;
-    int frameIndex = 0;
+    using Scope = scope::ScopeCapture<8, SCOPE_BUFFER_SIZE>;
+    Scope scopeCapture;
     
     dsp::SchmittTrigger triggers[16];
 
@@ -65,7 +59,7 @@ struct Obserfour : Module {
         bool trig = !params[TRIG_PARAM].getValue();
         lights[TRIG_LIGHT].setBrightness(trig);
 
-        if (bufferIndex >= SCOPE_BUFFER_SIZE) {
+        if (!scopeCapture.capturing()) {
             bool triggered = false;
 
             if (!trig) {
@@ -90,31 +84,19 @@ struct Obserfour : Module {
                 for (int c = 0; c < 16; c++) {
                     triggers[c].reset();
                 }
-                bufferIndex = 0;
-                frameIndex = 0;
+                scopeCapture.start();
             }
         }
 
-        if (bufferIndex < SCOPE_BUFFER_SIZE) {
-            float deltaTime = dsp::exp2_taylor5(-params[TIME_PARAM].getValue()) / SCOPE_BUFFER_SIZE;
-            int frameCount = (int) std::ceil(deltaTime * args.sampleRate);
-
-            for (int i = 0; i < 8; i++) {
-                float x = inputs[TRACK1_INPUT + i].getVoltage();
-                currentPoint[i].min = std::min(currentPoint[i].min, x);
-                currentPoint[i].max = std::max(currentPoint[i].max, x);
-            }
+        if (scopeCapture.capturing()) {
+            scopeCapture.setTime(params[TIME_PARAM].getValue(), args.sampleRate);
 
-            if (++frameIndex >= frameCount) {
-                frameIndex = 0;
-                for (int i = 0; i < 8; i++) {
-                    scopeBuffer[i][bufferIndex] = currentPoint[i];
-                }
-                for (int i = 0; i < 8; i++) {
-                    currentPoint[i] = ScopePoint();
-                }
-                bufferIndex++;
+            simd::float_4 x[2];
+            for (int g = 0; g < 2; g++) {
+                x[g] = simd::float_4(inputs[TRACK1_INPUT + 4 * g].getVoltage(), inputs[TRACK2_INPUT + 4 * g].getVoltage(),
+                                     inputs[TRACK3_INPUT + 4 * g].getVoltage(), inputs[TRACK4_INPUT + 4 * g].getVoltage());
             }
+            scopeCapture.push(x);
         }
     }
 };
@@ -127,7 +109,7 @@ struct ObserfourScopeDisplay : LedDisplay {
         box.size = Vec(120, 300);
     }
     
-    void drawWave(const DrawArgs& args, int inputIndex, int displayTrack, NVGcolor color) {
+    void drawWave(const DrawArgs& args, const Obserfour::Scope::Frame& frame, int inputIndex, int displayTrack, NVGcolor color) {
         if (!module) return;
         
         nvgSave(args.vg);
@@ -140,8 +122,7 @@ struct ObserfourScopeDisplay : LedDisplay {
         nvgBeginPath(args.vg);
         
         for (int i = 0; i < Obserfour::SCOPE_BUFFER_SIZE; i++) {
-            const Obserfour::ScopePoint& point = module->scopeBuffer[inputIndex][i];
-            float max = point.max;
+            float max = frame.maxAt(inputIndex, i);
             if (!std::isfinite(max))
                 max = 0.f;
 
@@ -210,18 +191,19 @@ struct ObserfourScopeDisplay : LedDisplay {
         
         if (!module || !moduleWidget) return;
         
+        const Obserfour::Scope::Frame& frame = module->scopeCapture.read();
         for (int i = 0; i < 4; i++) {
             PortWidget* inputPort1 = moduleWidget->getInput(Obserfour::TRACK1_INPUT + i);
             CableWidget* cable1 = APP->scene->rack->getTopCable(inputPort1);
             NVGcolor trackColor1 = cable1 ? cable1->color : nvgRGB(255, 255, 255);
             
-            drawWave(args, i, i, trackColor1);
+            drawWave(args, frame, i, i, trackColor1);
             
             PortWidget* inputPort2 = moduleWidget->getInput(Obserfour::TRACK5_INPUT + i);
             CableWidget* cable2 = APP->scene->rack->getTopCable(inputPort2);
             NVGcolor trackColor2 = cable2 ? cable2->color : nvgRGB(255, 255, 255);
             
-            drawWave(args, i + 4, i, trackColor2);
+            drawWave(args, frame, i + 4, i, trackColor2);
         }
     }
     
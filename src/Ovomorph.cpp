@@ -1,20 +1,6 @@
 #include "plugin.hpp"
-
-// ChaosGenerator - Lorenz Attractor
-struct OvomorphChaosGenerator {
-    float x = 0.1f, y = 0.1f, z = 0.1f;
-    void reset() { x = 0.1f; y = 0.1f; z = 0.1f; }
-    float process(float rate) {
-        float dt = rate * 0.001f;
-        float dx = 7.5f * (y - x);
-        float dy = x * (30.9f - z) - y;
-        float dz = x * y - 1.02f * z;
-        x += dx * dt; y += dy * dt; z += dz * dt;
-        if (std::isnan(x) || std::isnan(y) || std::isnan(z) ||
-            std::abs(x) > 100.0f || std::abs(y) > 100.0f || std::abs(z) > 100.0f) reset();
-        return clamp(x * 0.1f, -1.0f, 1.0f);
-    }
-};
+#include "LorenzChaos.hpp"
+#include "SilenceGate.hpp"
 
 // ReverbProcessor - Freeverb style (from RipleyDSP.hpp, 9-param version)
 struct OvomorphReverbProcessor {
@@ -123,11 +109,12 @@ struct Ovomorph : Module {
     };
     enum LightIds { NUM_LIGHTS };
 
-    OvomorphChaosGenerator chaosGen;
+    chaos::Lorenz chaosGen;
     OvomorphReverbProcessor leftReverbProcessor;
     OvomorphReverbProcessor rightReverbProcessor;
     float lastSHValue = 0.0f;
     float shPhase = 0.0f;
+    silence::Gate silenceGate;
 
     Ovomorph() {
         config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
@@ -147,6 +134,7 @@ struct Ovomorph : Module {
 
     void onReset() override {
         chaosGen.reset(); leftReverbProcessor.reset(); rightReverbProcessor.reset();
+        silenceGate.reset();
     }
 
     void process(const ProcessArgs& args) override {
@@ -176,6 +164,14 @@ struct Ovomorph : Module {
         if (!std::isfinite(leftInput)) leftInput = 0.0f;
         if (!std::isfinite(rightInput)) rightInput = 0.0f;
 
+        // The reverb sleeps once input and tail are silent; the chaos outputs keep running
+        float inputLevel = std::max(std::abs(leftInput), std::abs(rightInput));
+        if (!silenceGate.wake(inputLevel)) {
+            outputs[LEFT_OUTPUT].setVoltage(0.0f);
+            outputs[RIGHT_OUTPUT].setVoltage(0.0f);
+            return;
+        }
+
         float roomSize = params[ROOM_PARAM].getValue();
         if (inputs[ROOM_CV_INPUT].isConnected()) roomSize += inputs[ROOM_CV_INPUT].getVoltage() * 0.1f;
         roomSize = clamp(roomSize, 0.0f, 1.0f);
@@ -190,6 +186,7 @@ struct Ovomorph : Module {
 
         float leftReverb = leftReverbProcessor.process(leftInput, rightInput, roomSize, damping, decay, true, chaosEnabled, chaosRaw, args.sampleRate);
         float rightReverb = rightReverbProcessor.process(leftInput, rightInput, roomSize, damping, decay, false, chaosEnabled, chaosRaw, args.sampleRate);
+        silenceGate.track(std::max({inputLevel, std::abs(leftReverb), std::abs(rightReverb)}), args.sampleRate);
 
         float mix = params[MIX_PARAM].getValue();
         if (inputs[MIX_CV_INPUT].isConnected()) mix += inputs[MIX_CV_INPUT].getVoltage() * 0.1f;
@@ -85,6 +85,42 @@ protected:
     T x_[max_num_sections + 1][3];
 };
 
+static const SOSCoefficients kFilter44100x3[6] =
+{
+    { {2.21367761e-04,  3.61877861e-04,  2.21367761e-04,  }, {-1.47968518e+00, 5.67327017e-01,  } },
+    { {1.00000000e+00,  2.40205666e-01,  1.00000000e+00,  }, {-1.41447319e+00, 6.53870079e-01,  } },
+    { {1.00000000e+00,  -5.21616753e-01, 1.00000000e+00,  }, {-1.32925307e+00, 7.69191197e-01,  } },
+    { {1.00000000e+00,  -8.45683226e-01, 1.00000000e+00,  }, {-1.26222187e+00, 8.65918374e-01,  } },
+    { {1.00000000e+00,  -9.84909799e-01, 1.00000000e+00,  }, {-1.22528537e+00, 9.33103620e-01,  } },
+    { {1.00000000e+00,  -1.03796309e+00, 1.00000000e+00,  }, {-1.21826030e+00, 9.79850849e-01,  } },
+};
+
+static const SOSCoefficients kFilter48000x3[6] =
+{
+    { {1.96007199e-04,  3.15285921e-04,  1.96007199e-04,  }, {-1.49750952e+00, 5.79487424e-01,  } },
+    { {1.00000000e+00,  1.64502383e-01,  1.00000000e+00,  }, {-1.43900370e+00, 6.63196513e-01,  } },
+    { {1.00000000e+00,  -5.92180251e-01, 1.00000000e+00,  }, {-1.36241892e+00, 7.75058824e-01,  } },
+    { {1.00000000e+00,  -9.07488127e-01, 1.00000000e+00,  }, {-1.30223398e+00, 8.69165582e-01,  } },
+    { {1.00000000e+00,  -1.04177534e+00, 1.00000000e+00,  }, {-1.26951947e+00, 9.34679234e-01,  } },
+    { {1.00000000e+00,  -1.09276235e+00, 1.00000000e+00,  }, {-1.26454687e+00, 9.80322986e-01,  } },
+};
+
+static const SOSCoefficients kFilter88200x2[4] =
+{
+    { {2.14365982e-04,  3.44623888e-04,  2.14365982e-04,  }, {-1.51452976e+00, 5.91490930e-01,  } },
+    { {1.00000000e+00,  1.79359162e-01,  1.00000000e+00,  }, {-1.47183547e+00, 6.80572255e-01,  } },
+    { {1.00000000e+00,  -5.38724437e-01, 1.00000000e+00,  }, {-1.43146874e+00, 8.07690655e-01,  } },
+    { {1.00000000e+00,  -7.87018740e-01, 1.00000000e+00,  }, {-1.44140333e+00, 9.35690837e-01,  } },
+};
+
+static const SOSCoefficients kFilter96000x2[4] =
+{
+    { {1.61641472e-04,  2.48568843e-04,  1.61641472e-04,  }, {-1.55380079e+00, 6.19246801e-01,  } },
+    { {1.00000000e+00,  -3.58337351e-03, 1.00000000e+00,  }, {-1.52398393e+00, 7.01782713e-01,  } },
+    { {1.00000000e+00,  -7.04287499e-01, 1.00000000e+00,  }, {-1.49925870e+00, 8.20194004e-01,  } },
+    { {1.00000000e+00,  -9.36237613e-01, 1.00000000e+00,  }, {-1.51854773e+00, 9.39912778e-01,  } },
+};
+
 template <typename T>
 class AAFilter
 {
@@ -126,20 +162,42 @@ protected:
 
     void InitFilter(float sample_rate)
     {
+        // Designs cover the common host rates; anything in between uses the
+        // nearest one. At 176.4/192 kHz the core already runs fast enough, so
+        // it is driven at 1x with the filters bypassed.
+        static const CascadedSOS kFilterDesigns[] =
+        {
+            { 44100.f,  3, 6, kFilter44100x3 },
+            { 48000.f,  3, 6, kFilter48000x3 },
+            { 88200.f,  2, 4, kFilter88200x2 },
+            { 96000.f,  2, 4, kFilter96000x2 },
+            { 192000.f, 1, 0, nullptr },
+        };
+        static constexpr int kNumFilterDesigns = sizeof(kFilterDesigns) / sizeof(kFilterDesigns[0]);
 
-    const SOSCoefficients kFilter48000x3[6] = 
-    {
-        { {1.96007199e-04,  3.15285921e-04,  1.96007199e-04,  }, {-1.49750952e+00, 5.79487424e-01,  } },
-        { {1.00000000e+00,  1.64502383e-01,  1.00000000e+00,  }, {-1.43900370e+00, 6.63196513e-01,  } },
-        { {1.00000000e+00,  -5.92180251e-01, 1.00000000e+00,  }, {-1.36241892e+00, 7.75058824e-01,  } },
-        { {1.00000000e+00,  -9.07488127e-01, 1.00000000e+00,  }, {-1.30223398e+00, 8.69165582e-01,  } },
-        { {1.00000000e+00,  -1.04177534e+00, 1.00000000e+00,  }, {-1.26951947e+00, 9.34679234e-01,  } },
-        { {1.00000000e+00,  -1.09276235e+00, 1.00000000e+00,  }, {-1.26454687e+00, 9.80322986e-01,  } },
-    };
-    
-    up_filter_.Init(6, kFilter48000x3);
-    down_filter_.Init(6, kFilter48000x3);
-    oversampling_factor_ = 3;
+        const CascadedSOS* design = &kFilterDesigns[0];
+        float best_distance = std::fabs(std::log2(sample_rate / design->sample_rate));
+        for (int i = 1; i < kNumFilterDesigns; i++)
+        {
+            float distance = std::fabs(std::log2(sample_rate / kFilterDesigns[i].sample_rate));
+            if (distance < best_distance)
+            {
+                best_distance = distance;
+                design = &kFilterDesigns[i];
+            }
+        }
+
+        if (design->num_sections > 0)
+        {
+            up_filter_.Init(design->num_sections, design->coeffs);
+            down_filter_.Init(design->num_sections, design->coeffs);
+        }
+        else
+        {
+            up_filter_.Init(0);
+            down_filter_.Init(0);
+        }
+        oversampling_factor_ = design->oversampling_factor;
     }
 };
 
@@ -242,111 +300,121 @@ struct Pinpple : Module {
         LIGHTS_LEN
     };
 
+    static constexpr int MAX_VOICES = PORT_MAX_CHANNELS;
+    static constexpr int MAX_GROUPS = MAX_VOICES / 4;
+
+    // Each float_4 lane is an independent voice. The four filter cells are
+    // kept in separate vectors so the cascade needs no lane shuffling.
     struct RipplesBPFEngine {
         float sample_time_;
-        simd::float_4 cell_voltage_;
+        simd::float_4 cell_voltage_[4];
         ripples::AAFilter<simd::float_4> aa_filter_;
-        dsp::TRCFilter<simd::float_4> rc_filters_;
-        
+        ripples::AAFilter<simd::float_4> aa_v_oct_;
+        ripples::AAFilter<simd::float_4> aa_i_reso_;
+        dsp::TRCFilter<simd::float_4> ff_filter_;
+        dsp::TRCFilter<simd::float_4> freq_filter_;
+        dsp::TRCFilter<simd::float_4> res_filter_;
+
         RipplesBPFEngine() {
             setSampleRate(44100.f);
         }
-        
+
         void setSampleRate(float sample_rate) {
             sample_time_ = 1.f / sample_rate;
-            cell_voltage_ = simd::float_4(0.f);
+            for (int i = 0; i < 4; i++) {
+                cell_voltage_[i] = simd::float_4(0.f);
+            }
             aa_filter_.Init(sample_rate);
-            
+            aa_v_oct_.Init(sample_rate);
+            aa_i_reso_.Init(sample_rate);
+
             float oversample_rate = sample_rate * aa_filter_.GetOversamplingFactor();
             float freq_cut = 1.f / (2.f * M_PI * kFreqAmpR * kFreqAmpC);
             float res_cut  = 1.f / (2.f * M_PI * kResAmpR  * kResAmpC);
             float ff_cut = 1.f / (2.f * M_PI * kFeedforwardR * kFeedforwardC);
-            
-            auto cutoffs = simd::float_4(ff_cut, freq_cut, res_cut, 0.f);
-            rc_filters_.setCutoffFreq(cutoffs / oversample_rate);
+
+            ff_filter_.setCutoffFreq(simd::float_4(ff_cut / oversample_rate));
+            freq_filter_.setCutoffFreq(simd::float_4(freq_cut / oversample_rate));
+            res_filter_.setCutoffFreq(simd::float_4(res_cut / oversample_rate));
         }
-        
-        float process(float input, float freq_knob, float res_knob, float fm_cv) {
-            float v_oct = 0.f;
-            v_oct += (freq_knob - 1.f) * kFreqKnobVoltage;
-            v_oct += fm_cv;
-            v_oct = std::min(v_oct, 0.f);
-            
-            float i_reso = VtoIConverter(kResAmpR, 0.f, kResInputR, res_knob * kResKnobV, kResKnobR);
-            
+
+        simd::float_4 process(simd::float_4 input, simd::float_4 freq_knob, simd::float_4 res_knob, simd::float_4 fm_cv) {
+            simd::float_4 v_oct = (freq_knob - 1.f) * kFreqKnobVoltage + fm_cv;
+            v_oct = simd::fmin(v_oct, 0.f);
+
+            simd::float_4 i_reso = VtoIConverter(kResAmpR, kResInputR, res_knob * kResKnobV, kResKnobR);
+
             int oversampling_factor = aa_filter_.GetOversamplingFactor();
             float timestep = sample_time_ / oversampling_factor;
-            float audio_input = input + 1e-6 * (random::uniform() - 0.5f);
-            auto inputs = simd::float_4(audio_input, v_oct, i_reso, 0.f);
-            inputs *= oversampling_factor;
-            simd::float_4 outputs;
-            
+            simd::float_4 noise(random::uniform(), random::uniform(), random::uniform(), random::uniform());
+            simd::float_4 audio_input = input + 1e-6f * (noise - 0.5f);
+            audio_input *= oversampling_factor;
+            v_oct *= oversampling_factor;
+            i_reso *= oversampling_factor;
+            simd::float_4 output;
+
             for (int i = 0; i < oversampling_factor; i++) {
-                inputs = aa_filter_.ProcessUp((i == 0) ? inputs : 0.f);
-                outputs = CoreProcess(inputs, timestep);
-                outputs = aa_filter_.ProcessDown(outputs);
+                simd::float_4 a = aa_filter_.ProcessUp((i == 0) ? audio_input : 0.f);
+                simd::float_4 v = aa_v_oct_.ProcessUp((i == 0) ? v_oct : 0.f);
+                simd::float_4 r = aa_i_reso_.ProcessUp((i == 0) ? i_reso : 0.f);
+                output = aa_filter_.ProcessDown(CoreProcess(a, v, r, timestep));
             }
-            
-            return outputs[0];
+
+            return output;
         }
-        
+
     private:
-        simd::float_4 CoreProcess(simd::float_4 inputs, float timestep) {
-            rc_filters_.process(inputs);
-            
-            simd::float_4 control = rc_filters_.lowpass();
-            float v_oct = control[1];
-            float i_reso = control[2];
-            
-            float feedforward = rc_filters_.highpass()[0];
-            
-            simd::float_4 rad_per_s = -std::exp2f(v_oct) / kFilterCellRC;
-            
-            cell_voltage_ = StepRK2(timestep, cell_voltage_, [&](simd::float_4 vout) {
-                simd::float_4 vin = _mm_shuffle_ps(vout.v, vout.v, _MM_SHUFFLE(2, 1, 0, 3));
-                
-                float vp = feedforward * kFeedforwardGain;
-                float vn = vout[3] * kFeedbackGain;
-                float res = kFilterCellR * OTAVCA(vp, vn, i_reso);
-                simd::float_4 in = inputs[0] * kFilterInputGain + res;
-                
-                vin = _mm_move_ss(vin.v, in.v);
-                
-                simd::float_4 vsum = vin + vout;
-                simd::float_4 dvout = rad_per_s * vsum;
-                
-                dvout *= (1.f + vsum * kFilterCellSelfModulation);
-                
-                return dvout;
-            });
-            
-            cell_voltage_ = simd::clamp(cell_voltage_, -kOpampSatV, kOpampSatV);
-            
-            float lp1 = cell_voltage_[0];
-            float lp2 = cell_voltage_[1];
-            float bp2 = (lp1 + lp2) * kBP2Gain;
-            
-            return simd::float_4(bp2, 0.f, 0.f, 0.f);
+        simd::float_4 CoreProcess(simd::float_4 audio, simd::float_4 v_oct, simd::float_4 i_reso, float timestep) {
+            ff_filter_.process(audio);
+            freq_filter_.process(v_oct);
+            res_filter_.process(i_reso);
+
+            simd::float_4 vp = ff_filter_.highpass() * kFeedforwardGain;
+            simd::float_4 drive = audio * kFilterInputGain;
+            simd::float_4 reso = res_filter_.lowpass();
+            simd::float_4 rad_per_s = -dsp::exp2_taylor5(freq_filter_.lowpass()) / kFilterCellRC;
+
+            // RK2 (midpoint) step over all four cells
+            simd::float_4 k1[4], mid[4], k2[4];
+            CellDerivatives(cell_voltage_, k1, drive, vp, reso, rad_per_s);
+            for (int i = 0; i < 4; i++) {
+                mid[i] = cell_voltage_[i] + k1[i] * (timestep / 2.f);
+            }
+            CellDerivatives(mid, k2, drive, vp, reso, rad_per_s);
+            for (int i = 0; i < 4; i++) {
+                cell_voltage_[i] = simd::clamp(cell_voltage_[i] + timestep * k2[i], -kOpampSatV, kOpampSatV);
+            }
+
+            return (cell_voltage_[0] + cell_voltage_[1]) * kBP2Gain;
         }
-        
-        template <typename T, typename F>
-        T StepRK2(float dt, T y, F f) {
-            T k1 = f(y);
-            T k2 = f(y + k1 * dt / 2.f);
-            return y + dt * k2;
+
+        void CellDerivatives(const simd::float_4* vout, simd::float_4* dvout, simd::float_4 drive,
+                             simd::float_4 vp, simd::float_4 i_reso, simd::float_4 rad_per_s) {
+            simd::float_4 vn = vout[3] * kFeedbackGain;
+            simd::float_4 in = drive + kFilterCellR * OTAVCA(vp, vn, i_reso);
+
+            simd::float_4 vsum[4] = {
+                in + vout[0],
+                vout[0] + vout[1],
+                vout[1] + vout[2],
+                vout[2] + vout[3]
+            };
+            for (int i = 0; i < 4; i++) {
+                dvout[i] = rad_per_s * vsum[i] * (1.f + vsum[i] * kFilterCellSelfModulation);
+            }
         }
-        
-        float VtoIConverter(float rfb, float vc, float rc, float vp = 0.f, float rp = 1e12f) {
-            float vnom = -(vc * rfb / rc + vp * rfb / rp);
-            float vout = std::max(vnom, kVtoICollectorVSat);
+
+        simd::float_4 VtoIConverter(float rfb, float rc, simd::float_4 vp, float rp) {
+            simd::float_4 vnom = -(vp * rfb / rp);
+            simd::float_4 vout = simd::fmax(vnom, kVtoICollectorVSat);
             float nrc = rp * rfb;
             float nrp = rc * rfb;
             float nrfb = rc * rp;
-            float vneg = (vc * nrc + vp * nrp + vout * nrfb) / (nrc + nrp + nrfb);
-            float iout = (vneg - vout) / rfb;
-            return std::max(iout, 0.f);
+            simd::float_4 vneg = (vp * nrp + vout * nrfb) / (nrc + nrp + nrfb);
+            simd::float_4 iout = (vneg - vout) / rfb;
+            return simd::fmax(iout, 0.f);
         }
-        
+
         template <typename T>
         T OTAVCA(T vp, T vn, T i_abc) {
             const float kTemperature = 40.f;
@@ -354,15 +422,15 @@ struct Pinpple : Module {
             const float kKelvin = 273.15f;
             const float kVt = kKoverQ * (kTemperature + kKelvin);
             const float kZlim = 2.f * std::sqrt(3.f);
-            
+
             T vi = vp - vn;
             T zlim = kZlim;
             T z = simd::clamp(vi / (2 * kVt), -zlim, zlim);
-            
+
             T z2 = z * z;
             T q = 12.f + z2;
             T p = 12.f * z * q / (36.f * z2 + q * q);
-            
+
             return i_abc * p;
         }
     };
@@ -380,6 +448,7 @@ struct Pinpple : Module {
     struct TriggerGenerator {
         dsp::SchmittTrigger inputTrigger;
         dsp::PulseGenerator outputPulse;
+        bool lastPulse = false;
         
         bool process(float input) {
             if (inputTrigger.process(input)) {
@@ -389,19 +458,23 @@ struct Pinpple : Module {
             return false;
         }
         
-        float getTrigger(float sampleTime) {
-            return outputPulse.process(sampleTime) ? 10.0f : 0.0f;
+        // True on the first sample of each 2ms output pulse
+        bool processPulseEdge(float sampleTime) {
+            bool pulse = outputPulse.process(sampleTime);
+            bool edge = pulse && !lastPulse;
+            lastPulse = pulse;
+            return edge;
         }
     };
 
+    // Four voices of the low pass gate; trigger arguments are lane masks
     struct SimpleLPG {
-        dsp::SchmittTrigger trigger;
-        dsp::BiquadFilter lpf;
-        float env = 0.0f;
-        float attackTime = 0.006f;  // Default 6ms, configurable via menu
-        float decayTime = 0.05f;
-        bool attacking = false;
-        bool decaying = false;
+        simd::float_4 env = 0.f;
+        simd::float_4 attacking = 0.f;
+        simd::float_4 decaying = 0.f;
+        simd::float_4 z1 = 0.f;
+        simd::float_4 z2 = 0.f;
+        float attackTime = 0.006f;
         float sampleRate = 44100.0f;
         
         void setSampleRate(float sr) {
@@ -409,89 +482,89 @@ struct Pinpple : Module {
         }
         
         void reset() {
-            trigger.reset();
-            env = 0.0f;
-            attacking = false;
-            decaying = false;
+            env = 0.f;
+            attacking = 0.f;
+            decaying = 0.f;
+            z1 = 0.f;
+            z2 = 0.f;
         }
         
-        float process(float triggerInput, float resonanceParam, float input, float vcaAmount, float sampleTime) {
-            if (trigger.process(triggerInput)) {
-                attacking = true;
-                decaying = false;
-                env = 0.0f;
-            }
-            
-            if (attacking) {
-                env += sampleTime / attackTime;
-                if (env >= 1.0f) {
-                    env = 1.0f;
-                    attacking = false;
-                    decaying = true;
-                }
-            }
-            
-            if (decaying) {
-                decayTime = 0.01f + resonanceParam * 0.5f;
-                float decayRate = 1.0f / decayTime;
-                env -= env * decayRate * sampleTime * 10.0f;
-                if (env <= 0.001f) {
-                    env = 0.0f;
-                    decaying = false;
-                }
-            }
+        simd::float_4 process(simd::float_4 trigger, simd::float_4 resonanceParam, simd::float_4 input, simd::float_4 vcaAmount, float sampleTime) {
+            attacking = attacking | trigger;
+            decaying = simd::ifelse(trigger, 0.f, decaying);
+            env = simd::ifelse(trigger, 0.f, env);
+
+            env = simd::ifelse(attacking, env + sampleTime / attackTime, env);
+            simd::float_4 attackDone = attacking & (env >= 1.0f);
+            env = simd::ifelse(attackDone, 1.0f, env);
+            attacking = simd::ifelse(attackDone, 0.f, attacking);
+            decaying = decaying | attackDone;
+
+            simd::float_4 decayRate = 1.0f / (0.01f + resonanceParam * 0.5f);
+            env = simd::ifelse(decaying, env - env * decayRate * sampleTime * 10.0f, env);
+            simd::float_4 decayDone = decaying & (env <= 0.001f);
+            env = simd::ifelse(decayDone, 0.f, env);
+            decaying = simd::ifelse(decayDone, 0.f, decaying);
             
-            float cutoffFreq = 200.0f + env * 18000.0f;
-            lpf.setParameters(dsp::BiquadFilter::LOWPASS, cutoffFreq / sampleRate, 0.707f, 1.0f);
-            
-            float filtered = lpf.process(input);
-            float level = vcaAmount * env;
-            return filtered * level;
+            // Biquad lowpass, Q = 0.707, same response as dsp::BiquadFilter
+            simd::float_4 w = float(M_PI) * (200.0f + env * 18000.0f) / sampleRate;
+            simd::float_4 K = simd::sin(w) / simd::cos(w);
+            simd::float_4 KK = K * K;
+            simd::float_4 KQ = K / 0.707f;
+            simd::float_4 norm = 1.f / (1.f + KQ + KK);
+            simd::float_4 b0 = KK * norm;
+            simd::float_4 a1 = 2.f * (KK - 1.f) * norm;
+            simd::float_4 a2 = (1.f - KQ + KK) * norm;
+
+            simd::float_4 filtered = z1 + input * b0;
+            z1 = z2 + input * (2.f * b0) - filtered * a1;
+            z2 = input * b0 - filtered * a2;
+
+            return filtered * vcaAmount * env;
         }
     };
 
     struct VCAEnvelope {
-        dsp::SchmittTrigger trigger;
-        float env = 0.0f;
-        float attackTime = 0.006f;
-        bool attacking = false;
+        simd::float_4 env = 0.f;
+        simd::float_4 attacking = 0.f;
 
         void reset() {
-            trigger.reset();
-            env = 0.0f;
-            attacking = false;
+            env = 0.f;
+            attacking = 0.f;
         }
 
-        float process(float triggerInput, float sampleTime) {
-            if (trigger.process(triggerInput)) {
-                attacking = true;
-                env = 0.0f;
-            }
+        simd::float_4 process(simd::float_4 trigger, float attackTime, float sampleTime) {
+            attacking = attacking | trigger;
+            env = simd::ifelse(trigger, 0.f, env);
 
-            if (attacking) {
-                env += sampleTime / attackTime;
-                if (env >= 1.0f) {
-                    env = 1.0f;
-                    attacking = false;
-                }
-            }
+            env = simd::ifelse(attacking, env + sampleTime / attackTime, env);
+            simd::float_4 attackDone = attacking & (env >= 1.0f);
+            env = simd::ifelse(attackDone, 1.0f, env);
+            attacking = simd::ifelse(attackDone, 0.f, attacking);
 
             return env;
         }
     };
 
-    RipplesBPFEngine bpfEngine;
-    TriggerGenerator trigGen;
-    SimpleLPG lpg;
-    VCAEnvelope vcaEnv;
+    RipplesBPFEngine bpfEngine[MAX_GROUPS];
+    TriggerGenerator trigGen[MAX_VOICES];
+    SimpleLPG lpg[MAX_GROUPS];
+    VCAEnvelope vcaEnv[MAX_GROUPS];
     PinkNoiseGenerator<8> pinkNoiseGenerator;
     float lastPink = 0.0f;
 
+    // Per-voice trigger state gathered before the vector pass
+    alignas(16) float pingInput[MAX_VOICES] = {};
+    alignas(16) float pulseEdge[MAX_VOICES] = {};
+    alignas(16) float freqOffset[MAX_VOICES] = {};
+    alignas(16) float decayOffset[MAX_VOICES] = {};
+
 public:
-    RandomModulation randomMod;
+    RandomModulation randomMod[MAX_VOICES];
 
     float originalFreqParam = 0.5f;
     float originalResonanceParam = 0.5f;
+    float vcaAttackTime = 0.006f;
 
     dsp::SchmittTrigger muteTrigger;
     bool muteState = false;
@@ -522,8 +595,10 @@ public:
 
     void onSampleRateChange() override {
         float sr = APP->engine->getSampleRate();
-        bpfEngine.setSampleRate(sr);
-        lpg.setSampleRate(sr);
+        for (int g = 0; g < MAX_GROUPS; g++) {
+            bpfEngine[g].setSampleRate(sr);
+            lpg[g].setSampleRate(sr);
+        }
     }
 
     void process(const ProcessArgs& args) override {
@@ -531,40 +606,37 @@ public:
             muteState = !muteState;
             params[MUTE_PARAM].setValue(muteState ? 1.0f : 0.0f);
         }
+
+        // Voice count follows the widest of the trigger, frequency CV and FM inputs
+        int channels = std::max({1,
+            inputs[TRIG_INPUT].getChannels(),
+            inputs[FREQ_CV_INPUT].getChannels(),
+            inputs[FM_INPUT].getChannels(),
+            inputs[FM_MOD_CV_INPUT].getChannels()});
         
-        float triggerInput = inputs[TRIG_INPUT].getVoltage();
-        bool newTrigger = trigGen.process(triggerInput);
-        if (newTrigger) {
-            randomMod.trigger();
+        // Lanes past the channel count in the last group are kept silent
+        int paddedChannels = (channels + 3) & ~3;
+        for (int c = channels; c < paddedChannels; c++) {
+            pingInput[c] = 0.0f;
+            pulseEdge[c] = 0.0f;
         }
-        float trigger2ms = trigGen.getTrigger(args.sampleTime);
-        
-        float freqParam = rescale(params[FREQ_PARAM].getValue(), std::log2(kFreqKnobMin), std::log2(kFreqKnobMax), 0.f, 1.f);
-        float freqCV = 0.0f;
-        if (inputs[FREQ_CV_INPUT].isConnected()) {
-            float freqCVAttenuation = params[FREQ_CV_ATTEN_PARAM].getValue();
-            freqCV = inputs[FREQ_CV_INPUT].getVoltage() * freqCVAttenuation;
+        for (int c = 0; c < channels; c++) {
+            bool newTrigger = trigGen[c].process(inputs[TRIG_INPUT].getPolyVoltage(c));
+            if (newTrigger) {
+                randomMod[c].trigger();
+            }
+            pingInput[c] = newTrigger ? 10.0f : 0.0f;
+            pulseEdge[c] = trigGen[c].processPulseEdge(args.sampleTime) ? 1.0f : 0.0f;
+            freqOffset[c] = randomMod[c].freqOffset;
+            decayOffset[c] = randomMod[c].decayOffset;
         }
-        float finalFreq = clamp(freqParam + freqCV * 0.1f + randomMod.freqOffset, 0.0f, 1.0f);
         
+        float freqParam = rescale(params[FREQ_PARAM].getValue(), std::log2(kFreqKnobMin), std::log2(kFreqKnobMax), 0.f, 1.f);
+        float freqCVAttenuation = params[FREQ_CV_ATTEN_PARAM].getValue();
         float resonanceParam = params[RESONANCE_PARAM].getValue();
-        float resonanceCV = 0.0f;
-        if (inputs[RESONANCE_CV_INPUT].isConnected()) {
-            float resonanceCVAttenuation = params[RESONANCE_CV_ATTEN_PARAM].getValue();
-            resonanceCV = inputs[RESONANCE_CV_INPUT].getVoltage() / 10.0f * resonanceCVAttenuation;
-        }
-        float finalResonance = clamp(resonanceParam + resonanceCV + randomMod.decayOffset, 0.0f, 1.0f);
-        
+        float resonanceCVAttenuation = params[RESONANCE_CV_ATTEN_PARAM].getValue();
         float fmAmountParam = params[FM_AMOUNT_PARAM].getValue();
-        
-        float fmModCV = 0.0f;
-        if (inputs[FM_MOD_CV_INPUT].isConnected()) {
-            float fmModCVAttenuation = params[FM_MOD_CV_ATTEN_PARAM].getValue();
-            fmModCV = inputs[FM_MOD_CV_INPUT].getVoltage() / 10.0f * fmModCVAttenuation;
-        }
-        
-        float dynamicFMAmount = clamp(fmAmountParam + fmModCV, 0.0f, 1.0f);
-        
+        float fmModCVAttenuation = params[FM_MOD_CV_ATTEN_PARAM].getValue();
         float noiseMixParam = params[NOISE_MIX_PARAM].getValue();
         
         float pinkNoise = pinkNoiseGenerator.process() / 0.816f;
@@ -574,45 +646,78 @@ public:
         const float noiseGain = 5.f / std::sqrt(2.f);
         pinkNoise *= noiseGain * 0.8f;
         blueNoise *= noiseGain * 1.5f;
-        
-        float fmInput = inputs[FM_INPUT].getVoltage();
-        float mixedInput;
-        
+
+        float noiseLevel, fmLevel, noiseSource;
         if (noiseMixParam <= 0.5f) {
             float mix = noiseMixParam * 2.0f;
-            mixedInput = pinkNoise * (1.0f - mix) + fmInput * mix;
+            noiseLevel = 1.0f - mix;
+            fmLevel = mix;
+            noiseSource = pinkNoise;
         } else {
             float mix = (noiseMixParam - 0.5f) * 2.0f;
-            mixedInput = fmInput * (1.0f - mix) + blueNoise * mix;
+            noiseLevel = mix;
+            fmLevel = 1.0f - mix;
+            noiseSource = blueNoise;
         }
-        
-        float processedFM = lpg.process(trigger2ms, finalResonance, mixedInput, dynamicFMAmount, args.sampleTime);
-        
-        float pingInput = newTrigger ? 10.0f : 0.0f;
-        float bpfOutput = bpfEngine.process(pingInput, finalFreq, finalResonance, processedFM);
+        float noiseInput = noiseSource * noiseLevel;
 
-        // Apply VCA envelope to final output
-        float vcaEnvelope = vcaEnv.process(trigger2ms, args.sampleTime);
+        bool freqCVConnected = inputs[FREQ_CV_INPUT].isConnected();
+        bool resonanceCVConnected = inputs[RESONANCE_CV_INPUT].isConnected();
+        bool fmModCVConnected = inputs[FM_MOD_CV_INPUT].isConnected();
+        bool fmConnected = inputs[FM_INPUT].isConnected();
 
         bool isMuted = muteState;
-        float volume = params[VOLUME_PARAM].getValue();
-        float finalOutput = isMuted ? 0.0f : bpfOutput * vcaEnvelope * volume;
+        float volume = isMuted ? 0.0f : params[VOLUME_PARAM].getValue();
 
-        lights[MUTE_LIGHT].setBrightness(isMuted ? 1.0f : 0.0f);
+        for (int c = 0, g = 0; c < channels; c += 4, g++) {
+            simd::float_4 freqCV = 0.f;
+            if (freqCVConnected) {
+                freqCV = inputs[FREQ_CV_INPUT].getPolyVoltageSimd<simd::float_4>(c) * freqCVAttenuation;
+            }
+            simd::float_4 finalFreq = simd::clamp(freqParam + freqCV * 0.1f + simd::float_4::load(&freqOffset[c]), 0.0f, 1.0f);
+
+            simd::float_4 resonanceCV = 0.f;
+            if (resonanceCVConnected) {
+                resonanceCV = inputs[RESONANCE_CV_INPUT].getPolyVoltageSimd<simd::float_4>(c) / 10.0f * resonanceCVAttenuation;
+            }
+            simd::float_4 finalResonance = simd::clamp(resonanceParam + resonanceCV + simd::float_4::load(&decayOffset[c]), 0.0f, 1.0f);
+
+            simd::float_4 fmModCV = 0.f;
+            if (fmModCVConnected) {
+                fmModCV = inputs[FM_MOD_CV_INPUT].getPolyVoltageSimd<simd::float_4>(c) / 10.0f * fmModCVAttenuation;
+            }
+            simd::float_4 dynamicFMAmount = simd::clamp(fmAmountParam + fmModCV, 0.0f, 1.0f);
 
-        outputs[OUT_OUTPUT].setVoltage(finalOutput);
+            simd::float_4 mixedInput = noiseInput;
+            if (fmConnected) {
+                mixedInput += inputs[FM_INPUT].getPolyVoltageSimd<simd::float_4>(c) * fmLevel;
+            }
+
+            simd::float_4 trigger = simd::float_4::load(&pulseEdge[c]) > 0.f;
+            simd::float_4 processedFM = lpg[g].process(trigger, finalResonance, mixedInput, dynamicFMAmount, args.sampleTime);
+
+            simd::float_4 bpfOutput = bpfEngine[g].process(simd::float_4::load(&pingInput[c]), finalFreq, finalResonance, processedFM);
+
+            // Apply VCA envelope to final output
+            simd::float_4 vcaEnvelope = vcaEnv[g].process(trigger, vcaAttackTime, args.sampleTime);
+
+            outputs[OUT_OUTPUT].setVoltageSimd(bpfOutput * vcaEnvelope * volume, c);
+        }
+        outputs[OUT_OUTPUT].setChannels(channels);
+
+        lights[MUTE_LIGHT].setBrightness(isMuted ? 1.0f : 0.0f);
     }
 
     json_t* dataToJson() override {
         json_t* rootJ = json_object();
-        json_object_set_new(rootJ, "vcaAttackTime", json_real(vcaEnv.attackTime));
+        json_object_set_new(rootJ, "vcaAttackTime", json_real(vcaAttackTime));
         return rootJ;
     }
 
     void dataFromJson(json_t* rootJ) override {
         json_t* attackTimeJ = json_object_get(rootJ, "vcaAttackTime");
         if (attackTimeJ) {
-            vcaEnv.attackTime = json_real_value(attackTimeJ);
+            vcaAttackTime = json_real_value(attackTimeJ);
         }
     }
 };
@@ -689,7 +794,7 @@ struct PinppleWidget : ModuleWidget {
         menu->addChild(new MenuSeparator);
         menu->addChild(createMenuLabel("VCA Attack Time"));
 
-        float currentAttackTime = module->vcaEnv.attackTime;
+        float currentAttackTime = module->vcaAttackTime;
         std::string currentLabel = string::f("Current: %.3fms", currentAttackTime * 1000.0f);
         menu->addChild(createMenuLabel(currentLabel));
 
@@ -701,13 +806,13 @@ struct PinppleWidget : ModuleWidget {
                 void setValue(float value) override {
                     if (module) {
                         value = clamp(value, 0.0f, 1.0f);
-                        module->vcaEnv.attackTime = rescale(value, 0.0f, 1.0f, 0.0005f, 0.020f);
+                        module->vcaAttackTime = rescale(value, 0.0f, 1.0f, 0.0005f, 0.020f);
                     }
                 }
 
                 float getValue() override {
                     if (module) {
-                        return rescale(module->vcaEnv.attackTime, 0.0005f, 0.020f, 0.0f, 1.0f);
+                        return rescale(module->vcaAttackTime, 0.0005f, 0.020f, 0.0f, 1.0f);
                     }
                     return 0.275f;
                 }
@@ -719,7 +824,7 @@ struct PinppleWidget : ModuleWidget {
                 std::string getUnit() override { return " ms"; }
                 std::string getDisplayValueString() override {
                     if (module) {
-                        return string::f("%.2f", module->vcaEnv.attackTime * 1000.0f);
+                        return string::f("%.2f", module->vcaAttackTime * 1000.0f);
                     }
                     return "6.00";
                 }
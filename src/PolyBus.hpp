@@ -0,0 +1,108 @@
+#pragma once
+#include "plugin.hpp"
+
+// Channel-vectorized port access and the expander bus shared by the mixers.
+// Port state is cached once per process() call, then every read moves four
+// polyphony channels.
+namespace polybus {
+
+using rack::simd::float_4;
+using rack::engine::Input;
+
+// Connection and channel count of one input, read once per block
+struct PortState {
+    bool connected = false;
+    int channels = 0;
+
+    void read(Input& input) {
+        connected = input.isConnected();
+        channels = connected ? input.getChannels() : 0;
+    }
+};
+
+// Lanes c..c+3 that exist on a port with the given channel count
+inline float_4 laneMask(int c, int channels) {
+    return float_4((float)c, (float)(c + 1), (float)(c + 2), (float)(c + 3)) < float_4((float)channels);
+}
+
+// Channels past the cable's count read channel 0, so a mono or narrower
+// cable is spread across the whole bus
+inline float_4 loadOrFirst(Input& input, const PortState& state, int c) {
+    if (!state.connected)
+        return 0.f;
+    if (c + 4 <= state.channels)
+        return input.getVoltageSimd<float_4>(c);
+    if (c >= state.channels)
+        return float_4(input.getVoltage(0));
+    return rack::simd::ifelse(laneMask(c, state.channels), input.getVoltageSimd<float_4>(c), float_4(input.getVoltage(0)));
+}
+
+// Channels past the cable's count read silence
+inline float_4 loadOrZero(Input& input, const PortState& state, int c) {
+    if (c >= state.channels)
+        return 0.f;
+    if (c + 4 <= state.channels)
+        return input.getVoltageSimd<float_4>(c);
+    return input.getVoltageSimd<float_4>(c) & laneMask(c, state.channels);
+}
+
+// Expander bus. Each mixer publishes its finished output, exactly what leaves
+// its mix outputs, to the mixer on its right, which owns the double-buffered
+// message. A mixer that joins the bus reads only its direct left neighbour's
+// frame and adds it where the chain inputs are added, so the bus follows the
+// same topology as the chain cables it replaces. Bypassed mixers relay what
+// reaches their chain (cables, or the bus frame) on both paths.
+struct BusFrame {
+    alignas(16) float left[PORT_MAX_CHANNELS] = {};
+    alignas(16) float right[PORT_MAX_CHANNELS] = {};
+    int channels = 0;
+};
+
+inline bool isBusModel(const Model* model) {
+    return model && (model == modelU8 || model == modelYAMANOTE
+        || model == modelALEXANDERPLATZ || model == modelSHINJUKU);
+}
+
+// Messages from the left neighbour live in the receiving module
+inline void attachBus(Module* module, BusFrame frames[2]) {
+    module->leftExpander.producerMessage = &frames[0];
+    module->leftExpander.consumerMessage = &frames[1];
+}
+
+// Frame to fill for the right neighbour, or null when there is no mixer there
+inline BusFrame* busOutput(Module* module) {
+    Module* right = module->rightExpander.module;
+    if (!right || !isBusModel(right->model))
+        return nullptr;
+    return (BusFrame*)right->leftExpander.producerMessage;
+}
+
+// Frame the left neighbour published, or null when there is no mixer there
+inline const BusFrame* busInput(Module* module) {
+    Module* left = module->leftExpander.module;
+    if (!left || !isBusModel(left->model))
+        return nullptr;
+    return (const BusFrame*)module->leftExpander.consumerMessage;
+}
+
+inline void publishBus(Module* module, BusFrame* frame, int channels) {
+    frame->channels = channels;
+    module->rightExpander.module->leftExpander.requestMessageFlip();
+}
+
+// Bus lanes with the same padding as loadOrZero/loadOrFirst
+inline float_4 busOrZero(const float* samples, int channels, int c) {
+    if (c >= channels)
+        return 0.f;
+    return float_4::load(samples + c) & laneMask(c, channels);
+}
+
+inline float_4 busOrFirst(const float* samples, int channels, int c) {
+    if (channels == 0)
+        return 0.f;
+    if (c + 4 <= channels)
+        return float_4::load(samples + c);
+    return rack::simd::ifelse(laneMask(c, channels), float_4::load(samples + c), float_4(samples[0]));
+}
+
+} // namespace polybus
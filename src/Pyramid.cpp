@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "SilenceGate.hpp"
 struct Pyramid : Module {
 
     enum ParamId {
@@ -59,6 +60,8 @@ struct Pyramid : Module {
     float lastFilterValue = 0.f;
     float smoothedFilter = 0.f;
 
+    silence::Gate silenceGate;
+
     Pyramid() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
 
@@ -158,6 +161,18 @@ json_t* sendJ = json_object_get(rootJ, "sendPreLevel");
 
     void process(const ProcessArgs& args) override {
         float audioIn = inputs[AUDIO_INPUT].getVoltage();
+        float returnL = inputs[RETURN_L_INPUT].getVoltage();
+        float returnR = inputs[RETURN_R_INPUT].getVoltage();
+
+        // Filter and panner sleep once the inputs and the filter tail are silent
+        float inputLevel = std::max({std::abs(audioIn), std::abs(returnL), std::abs(returnR)});
+        if (!silenceGate.wake(inputLevel)) {
+            outputs[SEND_OUTPUT].setVoltage(0.f);
+            for (int i = 0; i < 8; i++) {
+                outputs[FL_UPPER_OUTPUT + i].setVoltage(0.f);
+            }
+            return;
+        }
 
         float x = params[X_PARAM].getValue();
         float y = params[Y_PARAM].getValue();
@@ -221,9 +236,7 @@ json_t* sendJ = json_object_get(rootJ, "sendPreLevel");
         }
 
         outputs[SEND_OUTPUT].setVoltage(sendOut);
-
-        float returnL = inputs[RETURN_L_INPUT].getVoltage();
-        float returnR = inputs[RETURN_R_INPUT].getVoltage();
+        silenceGate.track(std::max(inputLevel, std::abs(audioIn)), args.sampleRate);
 
         float gains[8];
         calculateVBAP(x, y, z, gains);
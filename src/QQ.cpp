@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "ScopeCapture.hpp"
 
 struct QQ : Module {
     enum ParamIds {
@@ -43,21 +44,17 @@ struct QQ : Module {
         bool gateState = false;
     };
 
-    struct ScopePoint {
-        float value = 0.f;
-    };
-
     TrackState tracks[3];
     
     static constexpr float ATTACK_TIME = 0.001f;
     static constexpr int SCOPE_BUFFER_SIZE = 128;
     
-    ScopePoint scopeBuffer[3][SCOPE_BUFFER_SIZE];
-    int scopeBufferIndex = 0;
-    int scopeFrameIndex = 0;
+    using Scope = scope::ScopeCapture<3, SCOPE_BUFFER_SIZE>;
+    Scope scopeCapture;
 
     QQ() {
         config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
+        scopeCapture.setScrolling(true);
         
         configParam(TRACK1_DECAY_TIME_PARAM, 0.01f, 2.f, 1.f, "Track 1 Decay Time", "s");
         configParam(TRACK1_SHAPE_PARAM, 0.f, 0.99f, 0.5f, "Track 1 Shape");
@@ -176,15 +173,11 @@ struct QQ : Module {
             outputs[TRACK1_ENV_OUTPUT + i].setVoltage(envOutput * 10.f);
         }
         
-        float deltaTime = dsp::exp2_taylor5(-params[SCOPE_TIME_PARAM].getValue()) / SCOPE_BUFFER_SIZE;
-        int frameCount = (int)std::ceil(deltaTime * args.sampleRate);
-        if (++scopeFrameIndex >= frameCount) {
-            scopeFrameIndex = 0;
-            for (int i = 0; i < 3; i++) {
-                scopeBuffer[i][scopeBufferIndex].value = outputs[TRACK1_ENV_OUTPUT + i].getVoltage();
-            }
-            scopeBufferIndex = (scopeBufferIndex + 1) % SCOPE_BUFFER_SIZE;
-        }
+        // Scrolling ring: every new point reaches the display
+        scopeCapture.setTime(params[SCOPE_TIME_PARAM].getValue(), args.sampleRate);
+        simd::float_4 env(outputs[TRACK1_ENV_OUTPUT].getVoltage(), outputs[TRACK2_ENV_OUTPUT].getVoltage(),
+                          outputs[TRACK3_ENV_OUTPUT].getVoltage(), 0.f);
+        scopeCapture.push(&env);
     }
 };
 
@@ -196,7 +189,7 @@ struct QQScopeDisplay : LedDisplay {
         box.size = Vec(60, 51);
     }
     
-    void drawWave(const DrawArgs& args, int track, NVGcolor color) {
+    void drawWave(const DrawArgs& args, const QQ::Scope::Frame& frame, int track, NVGcolor color) {
         if (!module) return;
         
         nvgSave(args.vg);
@@ -210,8 +203,8 @@ struct QQScopeDisplay : LedDisplay {
         nvgBeginPath(args.vg);
         
         for (int i = 0; i < QQ::SCOPE_BUFFER_SIZE; i++) {
-            float value = module->scopeBuffer[track][(i + module->scopeBufferIndex) % QQ::SCOPE_BUFFER_SIZE].value;
-            value = clamp(value, 0.f, 10.f);
+            float value = frame.maxAt(track, (i + frame.head) % QQ::SCOPE_BUFFER_SIZE);
+            value = std::isfinite(value) ? clamp(value, 0.f, 10.f) : 0.f;
             
             Vec p;
             p.x = (float)i / (QQ::SCOPE_BUFFER_SIZE - 1);
@@ -279,12 +272,13 @@ struct QQScopeDisplay : LedDisplay {
         
         if (!module || !moduleWidget) return;
         
+        const QQ::Scope::Frame& frame = module->scopeCapture.read();
         for (int i = 0; i < 3; i++) {
             PortWidget* inputPort = moduleWidget->getInput(QQ::TRACK1_TRIG_INPUT + i);
             CableWidget* cable = APP->scene->rack->getTopCable(inputPort);
             NVGcolor trackColor = cable ? cable->color : nvgRGB(255, 255, 255);
             
-            drawWave(args, i, trackColor);
+            drawWave(args, frame, i, trackColor);
         }
     }
     
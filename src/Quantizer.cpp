@@ -1,5 +1,8 @@
 #include "plugin.hpp"
 #include "Microtuning/MicrotunePresets.hpp"
+#include "Microtuning/ScalaTuning.hpp"
+#include "filesystem/async_filebrowser.hh"
+#include <atomic>
 
 using namespace Microtuning;
 
@@ -27,16 +30,48 @@ struct Quantizer : Module {
 
     bool enabledNotes[24];  // 24 notes (2 octaves)
     int ranges[48];         // 48 half-semitone slots for 2 octaves
-    bool playingNotes[24];
+    uint32_t playingMask = 0;  // bit per note (0-23) for the display
 
-    // Direction tracking
+    // Direction tracking, one lane per poly channel
     static const int MAX_POLY = 16;
-    float lastNote[3][MAX_POLY] = {};
-    bool ascending[3][MAX_POLY] = {};
+    static const int MAX_GROUPS = MAX_POLY / 4;
+    simd::float_4 lastNote[3][MAX_GROUPS];
+    simd::float_4 ascending[3][MAX_GROUPS];
     float ascCents[12] = {}, descCents[12] = {};
     bool hasDirectional = false;
     int currentPreset = 0;
 
+    // Scale, microtune and direction tables compiled into one flat lookup
+    // per half-semitone slot. Rebuilt on the audio thread when marked dirty.
+    struct ScaleLookup {
+        float ascVolts[48];   // output within a 2-octave block
+        float descVolts[48];  // same as ascVolts unless a directional preset is active
+        float semitones[48];  // quantized semitone within the block
+        int note24[48];       // display note index (0-23)
+    };
+    ScaleLookup lookup;
+    float compiledMicrotune[24] = {};
+    bool lookupDirty = true;
+    dsp::ClockDivider microtuneDivider;
+
+    // "Changed input only" fast path: groups whose input has not moved are skipped
+    bool changedInputOnly = false;
+    simd::float_4 lastPitch[3][MAX_GROUPS];
+    uint32_t groupPlaying[3][MAX_GROUPS] = {};
+    int lastChannels[3] = {};
+
+    // Scala (.scl/.kbm) tuning. Parsed and compiled on the UI side, then
+    // handed to process() by pointer; replaced lookups are freed once
+    // process() has finished a call that could still be reading them.
+    ScalaScale scalaScale;
+    ScalaMapping scalaMapping;
+    bool hasScalaMapping = false;
+    std::string sclPath, kbmPath;
+    std::atomic<ScalaLookup*> scalaLookup{nullptr};
+    std::atomic<uint32_t> processCount{0};
+    std::vector<std::pair<ScalaLookup*, uint32_t>> retiredScala;
+    ScalaLookup* activeScala = nullptr;  // audio thread only
+
     // Note names for 2 octaves
     static constexpr const char* NOTE_NAMES[24] = {
         "C1", "C#1", "D1", "D#1", "E1", "F1", "F#1", "G1", "G#1", "A1", "A#1", "B1",
@@ -63,18 +98,27 @@ struct Quantizer : Module {
         configOutput(PITCH_OUTPUT_2, "Pitch 2");
         configOutput(PITCH_OUTPUT_3, "Pitch 3");
         configBypass(PITCH_INPUT, PITCH_OUTPUT);
+        microtuneDivider.setDivision(64);
         onReset();
     }
 
+    ~Quantizer() {
+        delete scalaLookup.load();
+        for (auto& retired : retiredScala)
+            delete retired.first;
+    }
+
     void onReset() override {
         for (int i = 0; i < 24; i++)
             enabledNotes[i] = true;
         for (int i = 0; i < 12; i++)
             ascCents[i] = descCents[i] = 0.f;
         for (int t = 0; t < 3; t++)
-            for (int c = 0; c < MAX_POLY; c++) {
-                lastNote[t][c] = 0.f;
-                ascending[t][c] = true;
+            for (int g = 0; g < MAX_GROUPS; g++) {
+                lastNote[t][g] = 0.f;
+                ascending[t][g] = simd::float_4::mask();
+                lastPitch[t][g] = 0.f;
+                groupPlaying[t][g] = 0;
             }
         hasDirectional = false;
         updateRanges();
@@ -87,7 +131,24 @@ struct Quantizer : Module {
     }
 
     void process(const ProcessArgs& args) override {
-        bool playing[24] = {};
+        // Microtune params can be moved from the panel or mapped knobs
+        if (microtuneDivider.process() && refreshMicrotune())
+            lookupDirty = true;
+        bool forceUpdate = false;
+        if (lookupDirty) {
+            lookupDirty = false;
+            // Presets and patch loads set params and dirty the lookup in one
+            // go, so read them now rather than waiting for the divider
+            refreshMicrotune();
+            compileLookup();
+            forceUpdate = true;
+        }
+        ScalaLookup* scala = scalaLookup.load(std::memory_order_acquire);
+        if (scala != activeScala) {
+            activeScala = scala;
+            forceUpdate = true;
+        }
+
         float scale = params[SCALE_PARAM].getValue();
         if (inputs[SCALE_CV_INPUT].isConnected())
             scale += inputs[SCALE_CV_INPUT].getVoltage() * 0.2f;  // ±1V = ±0.2 scale
@@ -95,44 +156,167 @@ struct Quantizer : Module {
         if (inputs[OFFSET_CV_INPUT].isConnected())
             offset += inputs[OFFSET_CV_INPUT].getVoltage();
 
+        uint32_t playing = 0;
         for (int t = 0; t < 3; t++) {
             int ch = std::max(inputs[PITCH_INPUT + t].getChannels(), 1);
-            for (int c = 0; c < ch; c++) {
-                float pitch = inputs[PITCH_INPUT + t].getVoltage(c);
-                pitch = (pitch + offset) * scale;
-
-                // Map to 48 slots (2 octaves × 24 half-semitone slots)
-                // pitch * 12 = semitones, * 2 = half-semitone slots
-                int slot = std::floor(pitch * 24);
-                int twoOctaveBlock = eucDiv(slot, 48);
-                slot = eucMod(slot, 48);
-
-                // ranges[] stores note index within 2 octaves (0-23)
-                int qNote24 = ranges[slot];  // 0-23 within the 2-octave block
-                int qNoteSemitone = twoOctaveBlock * 24 + qNote24;  // absolute semitone
-
-                int noteIdx24 = eucMod(qNote24, 24);
-                int noteIdx12 = eucMod(qNote24, 12);
-                playing[noteIdx24] = true;
-
-                // Direction detection & microtune
-                float mt;
-                if (hasDirectional) {
-                    float diff = (float)qNoteSemitone - lastNote[t][c];
-                    if (diff > 0.5f) ascending[t][c] = true;
-                    else if (diff < -0.5f) ascending[t][c] = false;
-                    mt = ascending[t][c] ? ascCents[noteIdx12] : descCents[noteIdx12];
-                } else {
-                    mt = params[MICROTUNE_PARAM + noteIdx24].getValue();
+            bool trackForce = forceUpdate || ch != lastChannels[t];
+            lastChannels[t] = ch;
+
+            for (int c = 0, g = 0; c < ch; c += 4, g++) {
+                simd::float_4 pitch = (inputs[PITCH_INPUT + t].getVoltageSimd<simd::float_4>(c) + offset) * scale;
+                if (changedInputOnly && !trackForce && simd::movemask(pitch != lastPitch[t][g]) == 0) {
+                    playing |= groupPlaying[t][g];
+                    continue;
                 }
-                lastNote[t][c] = (float)qNoteSemitone;
-
-                // Output: 1V/octave = 12 semitones per volt
-                outputs[PITCH_OUTPUT + t].setVoltage((float)qNoteSemitone / 12.f + mt / 1200.f, c);
+                lastPitch[t][g] = pitch;
+
+                uint32_t bits = 0;
+                int lanes = std::min(ch - c, 4);
+                simd::float_4 volts = scala ? quantizeScala(scala, pitch, lanes, bits)
+                                            : quantizeScale(t, g, pitch, lanes, bits);
+                groupPlaying[t][g] = bits;
+                playing |= bits;
+                outputs[PITCH_OUTPUT + t].setVoltageSimd(volts, c);
             }
             outputs[PITCH_OUTPUT + t].setChannels(ch);
         }
-        std::memcpy(playingNotes, playing, sizeof(playing));
+        playingMask = playing;
+        processCount.store(processCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    simd::float_4 quantizeScale(int t, int g, simd::float_4 pitch, int lanes, uint32_t& bits) {
+        // Map to 48 slots (2 octaves × 24 half-semitone slots)
+        // pitch * 12 = semitones, * 2 = half-semitone slots
+        simd::float_4 slot = simd::floor(pitch * 24.f);
+        simd::float_4 twoOctaveBlock = simd::floor(slot / 48.f);
+        simd::float_4 index = slot - twoOctaveBlock * 48.f;
+
+        simd::float_4 ascVolts, descVolts, semitones;
+        for (int k = 0; k < 4; k++) {
+            int i = clamp((int)index[k], 0, 47);
+            ascVolts[k] = lookup.ascVolts[i];
+            descVolts[k] = lookup.descVolts[i];
+            semitones[k] = lookup.semitones[i];
+            if (k < lanes)
+                bits |= 1u << lookup.note24[i];
+        }
+
+        // Direction detection picks the ascending or descending tuning
+        simd::float_4 qNoteSemitone = twoOctaveBlock * 24.f + semitones;
+        simd::float_4 diff = qNoteSemitone - lastNote[t][g];
+        ascending[t][g] = simd::ifelse(diff > 0.5f, simd::float_4::mask(),
+                          simd::ifelse(diff < -0.5f, 0.f, ascending[t][g]));
+        lastNote[t][g] = qNoteSemitone;
+
+        // Output: 1V/octave, 2V per 2-octave block
+        return twoOctaveBlock * 2.f + simd::ifelse(ascending[t][g], ascVolts, descVolts);
+    }
+
+    simd::float_4 quantizeScala(const ScalaLookup* scala, simd::float_4 pitch, int lanes, uint32_t& bits) {
+        simd::float_4 x = pitch - scala->baseVolts;
+        simd::float_4 periods = simd::floor(x / scala->periodVolts);
+        simd::float_4 inPeriod = x - periods * scala->periodVolts;
+        simd::float_4 binPos = inPeriod * scala->binsPerVolt;
+
+        simd::float_4 nearestVolts;
+        for (int k = 0; k < 4; k++) {
+            int i = scala->nearest(clamp((int)binPos[k], 0, scala->bins - 1), inPeriod[k]);
+            nearestVolts[k] = scala->volts[i];
+            if (k < lanes)
+                bits |= 1u << scala->notes[i];
+        }
+        return scala->baseVolts + periods * scala->periodVolts + nearestVolts;
+    }
+
+    // Scala loading, UI thread only
+    void reclaimScala() {
+        uint32_t count = processCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < retiredScala.size();) {
+            if (retiredScala[i].second != count) {
+                delete retiredScala[i].first;
+                retiredScala.erase(retiredScala.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+
+    void installScala(ScalaLookup* next) {
+        reclaimScala();
+        ScalaLookup* previous = scalaLookup.exchange(next);
+        if (previous)
+            retiredScala.push_back({previous, processCount.load()});
+    }
+
+    void rebuildScala() {
+        if (sclPath.empty()) {
+            installScala(nullptr);
+            return;
+        }
+        ScalaLookup* next = compileScalaLookup(scalaScale, hasScalaMapping ? &scalaMapping : nullptr);
+        if (next)
+            next->name = scalaScale.description.empty() ? string::filename(sclPath) : scalaScale.description;
+        installScala(next);
+    }
+
+    bool loadScala(const std::string& path) {
+        ScalaScale scale;
+        if (!loadScalaScale(path.c_str(), scale))
+            return false;
+        scalaScale = scale;
+        sclPath = path;
+        rebuildScala();
+        return true;
+    }
+
+    bool loadKeyboardMapping(const std::string& path) {
+        ScalaMapping mapping;
+        if (!loadScalaMapping(path.c_str(), mapping))
+            return false;
+        scalaMapping = mapping;
+        hasScalaMapping = true;
+        kbmPath = path;
+        rebuildScala();
+        return true;
+    }
+
+    void clearScala() {
+        sclPath.clear();
+        kbmPath.clear();
+        hasScalaMapping = false;
+        installScala(nullptr);
+    }
+
+    // Copies the microtune params, true when any moved
+    bool refreshMicrotune() {
+        bool changed = false;
+        for (int i = 0; i < 24; i++) {
+            float mt = params[MICROTUNE_PARAM + i].getValue();
+            if (mt != compiledMicrotune[i]) {
+                compiledMicrotune[i] = mt;
+                changed = true;
+            }
+        }
+        return changed;
+    }
+
+    void compileLookup() {
+        for (int i = 0; i < 48; i++) {
+            int qNote24 = ranges[i];
+            int noteIdx24 = eucMod(qNote24, 24);
+            int noteIdx12 = eucMod(qNote24, 12);
+            float ascMt, descMt;
+            if (hasDirectional) {
+                ascMt = ascCents[noteIdx12];
+                descMt = descCents[noteIdx12];
+            } else {
+                ascMt = descMt = compiledMicrotune[noteIdx24];
+            }
+            lookup.ascVolts[i] = (float)qNote24 / 12.f + ascMt / 1200.f;
+            lookup.descVolts[i] = (float)qNote24 / 12.f + descMt / 1200.f;
+            lookup.semitones[i] = (float)qNote24;
+            lookup.note24[i] = noteIdx24;
+        }
     }
 
     void updateRanges() {
@@ -153,6 +337,7 @@ struct Quantizer : Module {
             }
             ranges[i] = closest;
         }
+        lookupDirty = true;
     }
 
     void applyPreset(int idx) {
@@ -160,6 +345,7 @@ struct Quantizer : Module {
         for (int i = 0; i < 24; i++)
             params[MICROTUNE_PARAM + i].setValue(p[i % 12]);
         hasDirectional = false;
+        lookupDirty = true;
     }
 
     void applyDirectional(int idx) {
@@ -173,6 +359,7 @@ struct Quantizer : Module {
             for (int i = 0; i < 24; i++)
                 params[MICROTUNE_PARAM + i].setValue(asc[i % 12]);
             hasDirectional = true;
+            lookupDirty = true;
         }
     }
 
@@ -188,6 +375,11 @@ struct Quantizer : Module {
         json_t* root = json_object();
 json_object_set_new(root, "currentPreset", json_integer(currentPreset));
         json_object_set_new(root, "hasDirectional", json_boolean(hasDirectional));
+        json_object_set_new(root, "changedInputOnly", json_boolean(changedInputOnly));
+        if (!sclPath.empty())
+            json_object_set_new(root, "sclPath", json_string(sclPath.c_str()));
+        if (!kbmPath.empty())
+            json_object_set_new(root, "kbmPath", json_string(kbmPath.c_str()));
 
         json_t* notes = json_array();
         for (int i = 0; i < 24; i++)
@@ -209,6 +401,11 @@ json_object_set_new(root, "currentPreset", json_integer(currentPreset));
         json_t* j;
 if ((j = json_object_get(root, "currentPreset"))) currentPreset = json_integer_value(j);
         if ((j = json_object_get(root, "hasDirectional"))) hasDirectional = json_boolean_value(j);
+        if ((j = json_object_get(root, "changedInputOnly"))) changedInputOnly = json_boolean_value(j);
+
+        clearScala();
+        if ((j = json_object_get(root, "kbmPath"))) loadKeyboardMapping(json_string_value(j));
+        if ((j = json_object_get(root, "sclPath"))) loadScala(json_string_value(j));
 
         if ((j = json_object_get(root, "enabledNotes"))) {
             size_t len = json_array_size(j);
@@ -271,7 +468,7 @@ struct NoteToggle : OpaqueWidget {
 
     void draw(const DrawArgs& args) override {
         bool enabled = module ? module->enabledNotes[noteIdx] : true;
-        bool playing = module ? module->playingNotes[noteIdx] : false;
+        bool playing = module ? (module->playingMask >> noteIdx) & 1 : false;
 
         nvgBeginPath(args.vg);
         nvgRoundedRect(args.vg, 0, 0, box.size.x, box.size.y, 1.5f);
@@ -326,7 +523,7 @@ struct MicrotuneSlider : OpaqueWidget {
 
     void draw(const DrawArgs& args) override {
         bool enabled = module ? module->enabledNotes[noteIdx] : true;
-        bool playing = module ? module->playingNotes[noteIdx] : false;
+        bool playing = module ? (module->playingMask >> noteIdx) & 1 : false;
         float value = module ? module->params[Quantizer::MICROTUNE_PARAM + noteIdx].getValue() : 0.f;
 
         // Background bar
@@ -467,7 +664,8 @@ for (int i = 0; i < 3; i++) {
 
     void step() override {
         if (auto* m = dynamic_cast<Quantizer*>(module))
-ModuleWidget::step();
+            m->reclaimScala();
+        ModuleWidget::step();
     }
 
     void appendContextMenu(ui::Menu* menu) override {
@@ -514,6 +712,36 @@ ModuleWidget::step();
             for (int i = 0; i < 3; i++)
                 sub->addChild(createMenuItem(dirNames[i], "", [=]() { m->applyDirectional(i); m->currentPreset = 100 + i; }));
         }));
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createBoolPtrMenuItem("Changed input only", "", &m->changedInputOnly));
+
+        // Scala tuning
+        menu->addChild(new MenuSeparator);
+        ScalaLookup* scala = m->scalaLookup.load();
+        menu->addChild(createMenuLabel(scala ? "Scala: " + scala->name : "Scala: none"));
+        menu->addChild(createMenuItem("Load Scala scale (.scl)", "", [=]() {
+            async_open_file("", "scl,SCL", "Load Scala scale",
+                [m](char* path) {
+                    if (path) {
+                        m->loadScala(path);
+                        free(path);
+                    }
+                }
+            );
+        }));
+        menu->addChild(createMenuItem("Load keyboard mapping (.kbm)", "", [=]() {
+            async_open_file("", "kbm,KBM", "Load keyboard mapping",
+                [m](char* path) {
+                    if (path) {
+                        m->loadKeyboardMapping(path);
+                        free(path);
+                    }
+                }
+            );
+        }));
+        if (scala || !m->kbmPath.empty())
+            menu->addChild(createMenuItem("Clear Scala tuning", "", [=]() { m->clearScala(); }));
 }
 };
 
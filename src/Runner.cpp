@@ -1,17 +1,5 @@
 #include "plugin.hpp"
-
-struct RunnerChaosGenerator {
-    float x = 0.1f, y = 0.1f, z = 0.1f;
-    void reset() { x = 0.1f; y = 0.1f; z = 0.1f; }
-    float process(float rate) {
-        float dt = rate * 0.001f;
-        float dx = 7.5f * (y - x); float dy = x * (30.9f - z) - y; float dz = x * y - 1.02f * z;
-        x += dx * dt; y += dy * dt; z += dz * dt;
-        if (std::isnan(x) || std::isnan(y) || std::isnan(z) ||
-            std::abs(x) > 100.0f || std::abs(y) > 100.0f || std::abs(z) > 100.0f) reset();
-        return clamp(x * 0.1f, -1.0f, 1.0f);
-    }
-};
+#include "LorenzChaos.hpp"
 
 struct Runner : Module {
     enum ParamIds {
@@ -36,7 +24,7 @@ struct Runner : Module {
     float rightDelayBuffer[DELAY_BUFFER_SIZE] = {};
     int delayWriteIndex = 0;
 
-    RunnerChaosGenerator chaosGen;
+    chaos::Lorenz chaosGen;
     float lastSHValue = 0.0f;
     float shPhase = 0.0f;
 
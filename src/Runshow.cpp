@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include <atomic>
 #include <chrono>
 
 static const int BUFFER_SIZE = 256;
@@ -42,24 +43,37 @@ struct Runshow : Module {
     dsp::SchmittTrigger startStopButtonTrigger;
 
     bool running = false;
+    bool pauseOnStop = false;  // start resumes the elapsed time instead of restarting it
     int clockCount = 0;
     int currentBar = 0;
     int quarter_notes = 0;
     int eighth_notes = 0;
     int sixteenth_notes = 0;
 
-    std::chrono::steady_clock::time_point startTime;
+    // Timebase is the number of samples processed while running, so timers
+    // follow audio time exactly, including offline or faster-than-realtime renders
+    int64_t elapsedSamples = 0;
+    float sampleRate = 0.f;
     float elapsedSeconds = 0.f;
     float lastClockTime = 0.f;
     int lastBarInCycle = -1;
 
+    // Optional wall-clock resync. The steady_clock is only read from the UI
+    // thread, which posts a corrected sample count for process() to pick up.
+    bool wallClockSync = false;
+    std::atomic<int64_t> pendingResyncSamples{-1};
+    std::atomic<uint32_t> resetCount{0};
+    std::chrono::steady_clock::time_point wallClockStart;
+    uint32_t wallClockResetCount = 0;
+    bool wallClockRunning = false;
+
     dsp::PulseGenerator timer30MinPulse;
     dsp::PulseGenerator timer15MinPulse;
     dsp::PulseGenerator barPulses[4];
 
-    // Simple timing variables
-    float last30MinTrigger = 0.f;
-    float last15MinTrigger = 0.f;
+    // Sample positions of the last timer triggers
+    int64_t last30MinTrigger = 0;
+    int64_t last15MinTrigger = 0;
 
     Runshow() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -92,9 +106,27 @@ struct Runshow : Module {
         configOutput(BAR_4_OUTPUT, "Bar 4");
 
         configLight(BEAT_LIGHT, "Beat");
+    }
 
-        // Initialize timing
-        startTime = std::chrono::steady_clock::now();
+    // Called from the UI thread only
+    void resyncFromWallClock() {
+        if (!wallClockSync || !running) {
+            wallClockRunning = false;
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        uint32_t currentResetCount = resetCount.load();
+        if (!wallClockRunning || currentResetCount != wallClockResetCount) {
+            wallClockResetCount = currentResetCount;
+            wallClockStart = now - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(elapsedSeconds));
+            wallClockRunning = true;
+            return;
+        }
+        double wallSeconds = std::chrono::duration<double>(now - wallClockStart).count();
+        if (std::fabs(wallSeconds - elapsedSeconds) > 0.05 && sampleRate > 0.f) {
+            pendingResyncSamples.store((int64_t)std::llround(wallSeconds * sampleRate));
+        }
     }
 
     void process(const ProcessArgs& args) override {
@@ -103,10 +135,35 @@ struct Runshow : Module {
         bool startStopTriggered = startStopTrigger.process(inputs[START_STOP_INPUT].getVoltage()) ||
                                   startStopButtonTrigger.process(params[START_STOP_PARAM].getValue());
 
+        if (args.sampleRate != sampleRate) {
+            // Keep elapsed time continuous across sample rate changes and patch loads
+            if (sampleRate > 0.f) {
+                double ratio = (double)args.sampleRate / sampleRate;
+                elapsedSamples = (int64_t)std::llround(elapsedSamples * ratio);
+                last30MinTrigger = (int64_t)std::llround(last30MinTrigger * ratio);
+                last15MinTrigger = (int64_t)std::llround(last15MinTrigger * ratio);
+            } else {
+                elapsedSamples = (int64_t)std::llround((double)elapsedSeconds * args.sampleRate);
+            }
+            sampleRate = args.sampleRate;
+        }
+
+        if (pendingResyncSamples.load(std::memory_order_relaxed) >= 0) {
+            int64_t resync = pendingResyncSamples.exchange(-1);
+            if (resync >= 0 && running) {
+                elapsedSamples = resync;
+            }
+        }
+
         if (startStopTriggered) {
             running = !running;
-            if (running) {
-                startTime = std::chrono::steady_clock::now();
+            if (running && !pauseOnStop) {
+                // Elapsed time and the timers count again from the start
+                elapsedSamples = 0;
+                elapsedSeconds = 0.f;
+                last30MinTrigger = 0;
+                last15MinTrigger = 0;
+                resetCount++;
             }
         }
 
@@ -116,17 +173,18 @@ struct Runshow : Module {
             quarter_notes = 0;
             eighth_notes = 0;
             sixteenth_notes = 0;
+            elapsedSamples = 0;
             elapsedSeconds = 0.f;
-            last30MinTrigger = 0.f;
-            last15MinTrigger = 0.f;
+            last30MinTrigger = 0;
+            last15MinTrigger = 0;
             lastBarInCycle = -1;
-            startTime = std::chrono::steady_clock::now();
+            resetCount++;
             lights[BEAT_LIGHT].setBrightness(0.f);
         }
 
         if (running) {
-            auto currentTime = std::chrono::steady_clock::now();
-            elapsedSeconds = std::chrono::duration<float>(currentTime - startTime).count();
+            elapsedSamples++;
+            elapsedSeconds = (float)(elapsedSamples * (double)args.sampleTime);
 
             if (clockTrigger.process(inputs[CLOCK_INPUT].getVoltage())) {
                 clockCount++;
@@ -175,17 +233,18 @@ struct Runshow : Module {
             }
 
             // Handle timer outputs
-            float timer30Interval = params[TIMER_30MIN_PARAM].getValue() * 60.0f; // Convert minutes to seconds
-            float timer15Interval = params[TIMER_15MIN_PARAM].getValue() * 60.0f;
+            // Convert minutes to samples
+            int64_t timer30Interval = (int64_t)(params[TIMER_30MIN_PARAM].getValue() * 60.0f * args.sampleRate);
+            int64_t timer15Interval = (int64_t)(params[TIMER_15MIN_PARAM].getValue() * 60.0f * args.sampleRate);
 
-            if (elapsedSeconds - last30MinTrigger >= timer30Interval) {
+            if (elapsedSamples - last30MinTrigger >= timer30Interval) {
                 timer30MinPulse.trigger(1e-3f);
-                last30MinTrigger = elapsedSeconds;
+                last30MinTrigger = elapsedSamples;
             }
 
-            if (elapsedSeconds - last15MinTrigger >= timer15Interval) {
+            if (elapsedSamples - last15MinTrigger >= timer15Interval) {
                 timer15MinPulse.trigger(1e-3f);
-                last15MinTrigger = elapsedSeconds;
+                last15MinTrigger = elapsedSamples;
             }
         }
 
@@ -211,6 +270,8 @@ struct Runshow : Module {
         json_object_set_new(rootJ, "clockCount", json_integer(clockCount));
         json_object_set_new(rootJ, "elapsedSeconds", json_real(elapsedSeconds));
         json_object_set_new(rootJ, "quarter_notes", json_integer(quarter_notes));
+        json_object_set_new(rootJ, "wallClockSync", json_boolean(wallClockSync));
+        json_object_set_new(rootJ, "pauseOnStop", json_boolean(pauseOnStop));
         return rootJ;
     }
 
@@ -227,10 +288,14 @@ struct Runshow : Module {
         json_t* quarterNotesJ = json_object_get(rootJ, "quarter_notes");
         if (quarterNotesJ) quarter_notes = json_integer_value(quarterNotesJ);
 
-        // Recalculate start time based on elapsed seconds
-        auto now = std::chrono::steady_clock::now();
-        startTime = now - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
-            std::chrono::duration<float>(elapsedSeconds));
+        json_t* wallClockSyncJ = json_object_get(rootJ, "wallClockSync");
+        if (wallClockSyncJ) wallClockSync = json_boolean_value(wallClockSyncJ);
+
+        json_t* pauseOnStopJ = json_object_get(rootJ, "pauseOnStop");
+        if (pauseOnStopJ) pauseOnStop = json_boolean_value(pauseOnStopJ);
+
+        // Sample count is rebuilt from elapsedSeconds on the next process()
+        sampleRate = 0.f;
     }
 };
 
@@ -439,6 +504,23 @@ struct RunshowWidget : ModuleWidget {
         addOutput(createOutputCentered<PJ301MPort>(Vec(137, 368), module, Runshow::BAR_3_OUTPUT));
         addOutput(createOutputCentered<PJ301MPort>(Vec(168, 368), module, Runshow::BAR_4_OUTPUT));
     }
+
+    void step() override {
+        ModuleWidget::step();
+        Runshow* module = getModule<Runshow>();
+        if (module) {
+            module->resyncFromWallClock();
+        }
+    }
+
+    void appendContextMenu(Menu* menu) override {
+        Runshow* module = getModule<Runshow>();
+        if (!module) return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createBoolPtrMenuItem("Start/stop pauses and resumes", "", &module->pauseOnStop));
+        menu->addChild(createBoolPtrMenuItem("Resync to wall clock", "", &module->wallClockSync));
+    }
 };
 
 Model* modelRunshow = createModel<Runshow, RunshowWidget>("Runshow");
\ No newline at end of file
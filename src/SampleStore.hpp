@@ -0,0 +1,274 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+// In-RAM sample storage for the recording modules (Launchpad, WeiiiDocumenta).
+// Every store holds CAPACITY mono samples in volts behind the same interface:
+//
+//   float read(int i) const              random access
+//   void readBlock(int begin, int count, float* out) const
+//                                         contiguous span, the fast path for playback
+//   void write(int i, float v)           any order, exact for float32
+//   void flush()                          finish pending encoding (no-op unless ADPCM)
+//   void clear()                          all samples back to 0 V
+//   uint32_t revision() const            changes on every write or clear
+//
+// Voices that step one or two samples at a time read through a BlockReader,
+// which keeps one decoded block per voice instead of decoding per sample.
+//
+// The backend is picked per buffer by its type, so the storage stays a fixed
+// array and MetaModule builds never allocate. Int16Store and AdpcmStore are
+// lossy and clip at +-FULL_SCALE, which is the Rack voltage rail.
+
+namespace sampling {
+
+// Largest voltage int16 and ADPCM keep without clipping
+static constexpr float FULL_SCALE = 12.0f;
+
+// 32-bit float, bit exact
+template <int CAPACITY>
+struct Float32Store {
+    static constexpr int SIZE = CAPACITY;
+
+    float read(int i) const { return data[i]; }
+
+    void readBlock(int begin, int count, float* out) const {
+        std::memcpy(out, &data[begin], count * sizeof(float));
+    }
+
+    void write(int i, float v) {
+        data[i] = v;
+        edits++;
+    }
+
+    void flush() {}
+
+    void clear() {
+        std::memset(data, 0, sizeof(data));
+        edits++;
+    }
+
+    uint32_t revision() const { return edits; }
+
+private:
+    float data[CAPACITY] = {};
+    uint32_t edits = 0;
+};
+
+// 16-bit linear over +-FULL_SCALE, half the memory, about 0.2 mV resolution
+template <int CAPACITY>
+struct Int16Store {
+    static constexpr int SIZE = CAPACITY;
+
+    float read(int i) const { return data[i] * TO_VOLTS; }
+
+    void readBlock(int begin, int count, float* out) const {
+        const int16_t* in = &data[begin];
+        for (int i = 0; i < count; i++) {
+            out[i] = in[i] * TO_VOLTS;
+        }
+    }
+
+    void write(int i, float v) {
+        float q = std::round(v * TO_CODE);
+        data[i] = (int16_t)std::max(-32767.0f, std::min(q, 32767.0f));
+        edits++;
+    }
+
+    void flush() {}
+
+    void clear() {
+        std::memset(data, 0, sizeof(data));
+        edits++;
+    }
+
+    uint32_t revision() const { return edits; }
+
+private:
+    static constexpr float TO_CODE = 32767.0f / FULL_SCALE;
+    static constexpr float TO_VOLTS = FULL_SCALE / 32767.0f;
+    int16_t data[CAPACITY] = {};
+    uint32_t edits = 0;
+};
+
+// IMA-style 4-bit ADPCM in independent 64-sample blocks (36 bytes each,
+// about 7x smaller than float). Each block header holds its first sample
+// and step index, so any block decodes on its own. Writes land in a
+// one-block float staging area that is encoded when the writer moves on
+// or flush() is called; reads see staged samples directly.
+template <int CAPACITY>
+struct AdpcmStore {
+    static constexpr int SIZE = CAPACITY;
+    static constexpr int BLOCK = 64;
+    static constexpr int NUM_BLOCKS = (CAPACITY + BLOCK - 1) / BLOCK;
+
+    AdpcmStore() { clear(); }
+
+    float read(int i) const {
+        float sample;
+        readBlock(i, 1, &sample);
+        return sample;
+    }
+
+    void readBlock(int begin, int count, float* out) const {
+        while (count > 0) {
+            int block = begin / BLOCK;
+            int offset = begin % BLOCK;
+            int span = std::min(count, BLOCK - offset);
+            if (block == staged) {
+                std::memcpy(out, &staging[offset], span * sizeof(float));
+            } else {
+                float decoded[BLOCK];
+                decode(blocks[block], decoded, offset + span);
+                std::memcpy(out, &decoded[offset], span * sizeof(float));
+            }
+            out += span;
+            begin += span;
+            count -= span;
+        }
+    }
+
+    void write(int i, float v) {
+        int block = i / BLOCK;
+        if (block != staged) {
+            flush();
+            decode(blocks[block], staging, BLOCK);
+            staged = block;
+        }
+        staging[i % BLOCK] = v;
+        edits++;
+    }
+
+    void flush() {
+        if (staged < 0) return;
+        encode(staging, blocks[staged]);
+        staged = -1;
+        edits++;  // reads now see the encoded samples
+    }
+
+    void clear() {
+        std::memset(blocks, 0, sizeof(blocks));
+        staged = -1;
+        edits++;
+    }
+
+    uint32_t revision() const { return edits; }
+
+private:
+    struct Block {
+        int16_t first;
+        uint8_t stepIndex;
+        uint8_t reserved;
+        uint8_t nibbles[BLOCK / 2];  // samples 1..63, low nibble first
+    };
+
+    Block blocks[NUM_BLOCKS];
+    float staging[BLOCK];
+    int staged = -1;
+    uint32_t edits = 0;
+
+    static constexpr float TO_CODE = 32767.0f / FULL_SCALE;
+    static constexpr float TO_VOLTS = FULL_SCALE / 32767.0f;
+
+    static const int16_t* stepTable() {
+        static const int16_t table[89] = {
+            7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+            50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+            253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+            1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+            3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+            12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+        };
+        return table;
+    }
+
+    static int indexStep(int nibble) {
+        static const int8_t table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+        return table[nibble & 7];
+    }
+
+    static int toCode(float v) {
+        float q = std::round(v * TO_CODE);
+        return (int)std::max(-32767.0f, std::min(q, 32767.0f));
+    }
+
+    // Applies one nibble to the predictor and step index
+    static void step(int nibble, int& predictor, int& stepIndex) {
+        int s = stepTable()[stepIndex];
+        int diff = s >> 3;
+        if (nibble & 4) diff += s;
+        if (nibble & 2) diff += s >> 1;
+        if (nibble & 1) diff += s >> 2;
+        predictor += (nibble & 8) ? -diff : diff;
+        predictor = std::max(-32767, std::min(predictor, 32767));
+        stepIndex = std::max(0, std::min(stepIndex + indexStep(nibble), 88));
+    }
+
+    static void encode(const float* in, Block& block) {
+        int predictor = toCode(in[0]);
+        // Start with a step size matching the first difference so loud
+        // blocks do not spend their opening samples catching up
+        int firstDelta = std::abs(toCode(in[1]) - predictor);
+        int stepIndex = 0;
+        while (stepIndex < 88 && stepTable()[stepIndex] < firstDelta)
+            stepIndex++;
+        block.first = (int16_t)predictor;
+        block.stepIndex = (uint8_t)stepIndex;
+        std::memset(block.nibbles, 0, sizeof(block.nibbles));
+        for (int i = 1; i < BLOCK; i++) {
+            int delta = toCode(in[i]) - predictor;
+            int s = stepTable()[stepIndex];
+            int nibble = 0;
+            if (delta < 0) {
+                nibble = 8;
+                delta = -delta;
+            }
+            if (delta >= s) { nibble |= 4; delta -= s; }
+            if (delta >= s >> 1) { nibble |= 2; delta -= s >> 1; }
+            if (delta >= s >> 2) { nibble |= 1; }
+            step(nibble, predictor, stepIndex);
+            block.nibbles[(i - 1) >> 1] |= nibble << (((i - 1) & 1) * 4);
+        }
+    }
+
+    // Decodes the first `count` samples of a block
+    static void decode(const Block& block, float* out, int count) {
+        int predictor = block.first;
+        int stepIndex = block.stepIndex;
+        out[0] = predictor * TO_VOLTS;
+        for (int i = 1; i < count; i++) {
+            int nibble = (block.nibbles[(i - 1) >> 1] >> (((i - 1) & 1) * 4)) & 15;
+            step(nibble, predictor, stepIndex);
+            out[i] = predictor * TO_VOLTS;
+        }
+    }
+};
+
+// One decoded block of a store, refilled when a read leaves it or the store
+// has been written since. Blocks line up with AdpcmStore's, so each refill
+// decodes exactly one of them.
+template <typename Store>
+struct BlockReader {
+    static constexpr int BLOCK = 64;
+
+    float read(const Store& store, int i) {
+        int begin = i & ~(BLOCK - 1);
+        if (begin != cachedBegin || store.revision() != cachedRevision) {
+            store.readBlock(begin, std::min(BLOCK, Store::SIZE - begin), samples);
+            cachedBegin = begin;
+            cachedRevision = store.revision();
+        }
+        return samples[i - begin];
+    }
+
+    void reset() { cachedBegin = -1; }
+
+private:
+    float samples[BLOCK];
+    int cachedBegin = -1;
+    uint32_t cachedRevision = 0;
+};
+
+} // namespace sampling
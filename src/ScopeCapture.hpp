@@ -0,0 +1,159 @@
+#pragma once
+#include "plugin.hpp"
+#include <atomic>
+
+// Min/max scope capture shared by the scope displays. The audio thread
+// decimates up to 16 tracks, four per float_4, into a back frame. Finished
+// sweeps are handed to the widget through a lock-free triple buffer, so the
+// display always draws a complete frame and never waits on the engine.
+// In scrolling mode the frame is a ring of the latest points instead, and
+// every finished point is handed over, so slow time settings still move.
+namespace scope {
+
+using rack::simd::float_4;
+
+template <int TRACKS, int LENGTH>
+struct ScopeCapture {
+    static_assert(TRACKS >= 1 && TRACKS <= PORT_MAX_CHANNELS, "ScopeCapture handles 1 to 16 tracks");
+    static constexpr int GROUPS = (TRACKS + 3) / 4;
+
+    struct Frame {
+        float_4 min[LENGTH][GROUPS];
+        float_4 max[LENGTH][GROUPS];
+        int head = 0;  // oldest point; always 0 for sweeps
+
+        float minAt(int track, int i) const { return min[i][track / 4][track % 4]; }
+        float maxAt(int track, int i) const { return max[i][track / 4][track % 4]; }
+
+        void clear() {
+            for (int i = 0; i < LENGTH; i++) {
+                for (int g = 0; g < GROUPS; g++) {
+                    min[i][g] = INFINITY;
+                    max[i][g] = -INFINITY;
+                }
+            }
+        }
+    };
+
+    ScopeCapture() {
+        for (Frame& frame : frames)
+            frame.clear();
+        resetPoint();
+    }
+
+    // Samples per point for a time knob value (log2 of 1 / screen seconds).
+    // Only recomputed when the knob or sample rate moves.
+    void setTime(float time, float sampleRate) {
+        if (time == lastTime && sampleRate == lastSampleRate)
+            return;
+        lastTime = time;
+        lastSampleRate = sampleRate;
+        float deltaTime = dsp::exp2_taylor5(-time) / LENGTH;
+        frameCount = std::max(1, (int)std::ceil(deltaTime * sampleRate));
+    }
+
+    // Run as a ring that never stops instead of sweep by sweep
+    void setScrolling(bool enabled) {
+        scrolling = enabled;
+        start();
+    }
+
+    // False once a sweep is complete and the capture waits for start()
+    bool capturing() const { return pointIndex < LENGTH; }
+
+    void start() {
+        pointIndex = 0;
+        frameIndex = 0;
+        resetPoint();
+    }
+
+    // One sample for every track, GROUPS vectors wide
+    void push(const float_4* values) {
+        if (pointIndex >= LENGTH)
+            return;
+        for (int g = 0; g < GROUPS; g++) {
+            currentMin[g] = rack::simd::fmin(currentMin[g], values[g]);
+            currentMax[g] = rack::simd::fmax(currentMax[g], values[g]);
+        }
+        if (++frameIndex < frameCount)
+            return;
+
+        frameIndex = 0;
+        Frame& frame = frames[back];
+        for (int g = 0; g < GROUPS; g++) {
+            frame.min[pointIndex][g] = currentMin[g];
+            frame.max[pointIndex][g] = currentMax[g];
+        }
+        resetPoint();
+        if (scrolling) {
+            pointIndex = (pointIndex + 1) % LENGTH;
+            frame.head = pointIndex;
+            publishScroll();
+        } else if (++pointIndex >= LENGTH) {
+            publish();
+        }
+    }
+
+    // UI thread: the most recent complete sweep
+    const Frame& read() {
+        if (middle.load(std::memory_order_acquire) & FRESH)
+            front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return frames[front];
+    }
+
+private:
+    static constexpr int INDEX_MASK = 3;
+    static constexpr int FRESH = 4;  // set on the middle index until the UI picks it up
+
+    Frame frames[3];
+    int back = 0;                    // audio thread only
+    int front = 1;                   // UI thread only
+    std::atomic<int> middle{2};
+
+    float_4 currentMin[GROUPS];
+    float_4 currentMax[GROUPS];
+    int pointIndex = 0;
+    int frameIndex = 0;
+    int frameCount = 1;
+    float lastTime = NAN;
+    float lastSampleRate = 0.f;
+
+    bool scrolling = false;
+    uint32_t points = 0;             // points written while scrolling
+    uint32_t stamps[3] = {};         // `points` when each frame was last brought up to date
+
+    void resetPoint() {
+        for (int g = 0; g < GROUPS; g++) {
+            currentMin[g] = INFINITY;
+            currentMax[g] = -INFINITY;
+        }
+    }
+
+    void publish() {
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // Hands over the ring after each point. The frame that comes back missed
+    // the points written since it was last current; only those are copied
+    // over from the one just published.
+    void publishScroll() {
+        int published = back;
+        stamps[published] = ++points;
+        publish();
+
+        const Frame& source = frames[published];
+        Frame& frame = frames[back];
+        int missing = (int)std::min<uint32_t>(points - stamps[back], LENGTH);
+        for (int n = 1; n <= missing; n++) {
+            int i = (pointIndex - n + LENGTH) % LENGTH;
+            for (int g = 0; g < GROUPS; g++) {
+                frame.min[i][g] = source.min[i][g];
+                frame.max[i][g] = source.max[i][g];
+            }
+        }
+        frame.head = pointIndex;
+        stamps[back] = points;
+    }
+};
+
+} // namespace scope
@@ -0,0 +1,49 @@
+#pragma once
+
+// Lets an effect skip its DSP graph once its inputs and its internal tail
+// have both stayed below a floor for the hold time. The floor sits far above
+// the denormal range, so feedback paths are put to sleep long before they
+// decay into denormals, and any input above it wakes the module on the
+// same sample.
+namespace silence {
+
+struct Gate {
+    static constexpr float FLOOR = 1e-5f;  // volts, about -120 dB below 10 V
+
+    float holdSeconds = 0.25f;  // must cover the longest delay in the graph
+    int quietSamples = 0;
+    bool asleep = false;
+
+    Gate() {}
+    explicit Gate(float holdSeconds) : holdSeconds(holdSeconds) {}
+
+    void reset() {
+        quietSamples = 0;
+        asleep = false;
+    }
+
+    // Before processing, with the loudest input sample. False means the
+    // module is asleep and can skip its graph for this sample.
+    bool wake(float inputLevel) {
+        if (inputLevel > FLOOR) {
+            quietSamples = 0;
+            asleep = false;
+        }
+        return !asleep;
+    }
+
+    // After processing, with the loudest input or tail sample. Returns true
+    // on the sample the module falls asleep, so it can clear its state.
+    bool track(float level, float sampleRate) {
+        if (level > FLOOR) {
+            quietSamples = 0;
+            return false;
+        }
+        if (++quietSamples < holdSeconds * sampleRate)
+            return false;
+        asleep = true;
+        return true;
+    }
+};
+
+} // namespace silence
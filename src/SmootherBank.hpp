@@ -0,0 +1,74 @@
+#pragma once
+#include "plugin.hpp"
+
+// One-pole parameter smoothers packed four to a float_4. The coefficient
+// comes from a time constant in ms and the current sample rate, so the
+// glide sounds the same at any rate. Groups whose lanes have all reached
+// their targets are skipped until a target moves again.
+namespace smoothing {
+
+using rack::simd::float_4;
+
+template <int N>
+struct SmootherBank {
+    static constexpr int GROUPS = (N + 3) / 4;
+    static constexpr float TOLERANCE = 1e-5f;  // relative, settled lanes snap to target
+
+    SmootherBank() {
+        for (int g = 0; g < GROUPS; g++) {
+            value[g] = 0.f;
+            target[g] = 0.f;
+            moving[g] = false;
+        }
+    }
+
+    void setTimeMs(float ms) {
+        timeMs = ms;
+        sampleRate = 0.f;  // recompute on the next setSampleRate()
+    }
+
+    // Cheap to call every sample, the coefficient only changes with the rate
+    void setSampleRate(float newSampleRate) {
+        if (newSampleRate == sampleRate)
+            return;
+        sampleRate = newSampleRate;
+        coeff = 1.f - std::exp(-1000.f / (timeMs * sampleRate));
+    }
+
+    void reset(int i, float v) {
+        value[i / 4][i % 4] = v;
+        target[i / 4][i % 4] = v;
+    }
+
+    void setTarget(int i, float v) {
+        if (target[i / 4][i % 4] != v) {
+            target[i / 4][i % 4] = v;
+            moving[i / 4] = true;
+        }
+    }
+
+    void process() {
+        for (int g = 0; g < GROUPS; g++) {
+            if (!moving[g])
+                continue;
+            float_4 v = value[g] + (target[g] - value[g]) * coeff;
+            float_4 settled = rack::simd::fabs(target[g] - v) <= TOLERANCE * (rack::simd::fabs(target[g]) + 1.f);
+            value[g] = rack::simd::ifelse(settled, target[g], v);
+            moving[g] = rack::simd::movemask(settled) != 0xF;
+        }
+    }
+
+    float get(int i) const {
+        return value[i / 4][i % 4];
+    }
+
+private:
+    float_4 value[GROUPS];
+    float_4 target[GROUPS];
+    bool moving[GROUPS];
+    float timeMs = 4.5f;  // matches the old fixed 0.995 coefficient at 44.1 kHz
+    float sampleRate = 0.f;
+    float coeff = 0.005f;
+};
+
+} // namespace smoothing
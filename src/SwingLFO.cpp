@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "FastMath.hpp"
 
 struct SwingLFO : Module {
     enum ParamId {
@@ -94,7 +95,7 @@ struct SwingLFO : Module {
         if (inputs[FREQ_CV_INPUT].isConnected()) {
             freqCV = inputs[FREQ_CV_INPUT].getVoltage() * freqCVAttenuation;
         }
-        float freq = std::pow(2.0f, freqParam + freqCV) * 1.0f;
+        float freq = fastmath::exp2(freqParam + freqCV);
         
         float swingParam = params[SWING_PARAM].getValue();
         float swingCV = 0.0f;
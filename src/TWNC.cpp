@@ -1,4 +1,6 @@
 #include "plugin.hpp"
+#include "ClockDivMult.hpp"
+#include "FastMath.hpp"
 
 static const float kFreqKnobMin = 20.f;
 static const float kFreqKnobMax = 20000.f;
@@ -184,7 +186,7 @@ struct SimpleSineVCO {
     }
     
     float process(float freq_hz, float fm_cv) {
-        float modulated_freq = freq_hz * std::pow(2.0f, fm_cv);
+        float modulated_freq = freq_hz * fastmath::exp2(fm_cv);
         modulated_freq = clamp(modulated_freq, 1.0f, sampleRate * 0.45f);
         
         float delta_phase = modulated_freq / sampleRate;
@@ -194,7 +196,7 @@ struct SimpleSineVCO {
             phase -= 1.0f;
         }
         
-        float sine_wave = std::sin(2.0f * M_PI * phase);
+        float sine_wave = fastmath::sin2pi(phase);
         
         return sine_wave * 5.0f;
     }
@@ -248,8 +250,7 @@ struct TWNC : Module {
     dsp::SchmittTrigger resetTrigger;
     dsp::SchmittTrigger manualResetTrigger;
     
-    float globalClockSeconds = 0.5f;
-    float secondsSinceLastClock = -1.0f;
+    divmult::ClockPeriod clockPeriod;
     
     dsp::PulseGenerator track1FlashPulse;
     dsp::PulseGenerator track2FlashPulse;
@@ -291,16 +292,7 @@ struct TWNC : Module {
     };
 
     struct TrackState {
-        int divMultValue = 0;
-        int division = 1;
-        int multiplication = 1;
-        float dividedClockSeconds = 0.5f;
-        float multipliedClockSeconds = 0.5f;
-        float dividedProgressSeconds = 0.0f;
-        float gateSeconds = 0.0f;
-        int dividerCount = 0;
-        bool shouldStep = false;
-        bool prevMultipliedGate = false;
+        divmult::ClockDivMult clockDivMult;
         
         int currentStep = 0;
         int length = 16;
@@ -314,10 +306,7 @@ struct TWNC : Module {
         UnifiedEnvelope vcaEnvelope;
 
         void reset() {
-            dividedProgressSeconds = 0.0f;
-            dividerCount = 0;
-            shouldStep = false;
-            prevMultipliedGate = false;
+            clockDivMult.reset();
             currentStep = 0;
             for (int i = 0; i < 32; ++i) {
                 pattern[i] = false;
@@ -327,70 +316,11 @@ struct TWNC : Module {
             vcaEnvelope.reset();
         }
         
+        // Track 2 ratios: 1/2x, 1x, 3/2x, 2x, 3x
         void updateDivMult(int divMultParam) {
-            divMultValue = divMultParam;
-            switch (divMultParam) {
-                case 0:
-                    division = 2;
-                    multiplication = 1;
-                    break;
-                case 1:
-                    division = 1;
-                    multiplication = 1;
-                    break;
-                case 2:
-                    division = 2;
-                    multiplication = 3;
-                    break;
-                case 3:
-                    division = 1;
-                    multiplication = 2;
-                    break;
-                case 4:
-                    division = 1;
-                    multiplication = 3;
-                    break;
-                default:
-                    division = 1;
-                    multiplication = 1;
-                    break;
-            }
-        }
-        
-        bool processClockDivMult(bool globalClock, float globalClockSeconds, float sampleTime) {
-            dividedClockSeconds = globalClockSeconds * (float)division;
-            multipliedClockSeconds = dividedClockSeconds / (float)multiplication;
-            gateSeconds = std::max(0.001f, multipliedClockSeconds * 0.5f);
-            
-            if (globalClock) {
-                if (dividerCount < 1) {
-                    dividedProgressSeconds = 0.0f;
-                } else {
-                    dividedProgressSeconds += sampleTime;
-                }
-                ++dividerCount;
-                if (dividerCount >= division) {
-                    dividerCount = 0;
-                }
-            } else {
-                dividedProgressSeconds += sampleTime;
-            }
-            
-            shouldStep = false;
-            if (dividedProgressSeconds < dividedClockSeconds) {
-                float multipliedProgressSeconds = dividedProgressSeconds / multipliedClockSeconds;
-                multipliedProgressSeconds -= (float)(int)multipliedProgressSeconds;
-                multipliedProgressSeconds *= multipliedClockSeconds;
-                
-                bool currentMultipliedGate = multipliedProgressSeconds <= gateSeconds;
-                
-                if (currentMultipliedGate && !prevMultipliedGate) {
-                    shouldStep = true;
-                }
-                prevMultipliedGate = currentMultipliedGate;
-            }
-            
-            return shouldStep;
+            static const int kRatios[5][2] = {{2, 1}, {1, 1}, {2, 3}, {1, 2}, {1, 3}};
+            int index = (divMultParam >= 0 && divMultParam < 5) ? divMultParam : 1;
+            clockDivMult.setRatio(kRatios[index][0], kRatios[index][1]);
         }
         
         void stepTrack() {
@@ -484,8 +414,7 @@ struct TWNC : Module {
     }
 
     void onReset() override {
-        secondsSinceLastClock = -1.0f;
-        globalClockSeconds = 0.5f;
+        clockPeriod.reset();
         for (int i = 0; i < 2; ++i) {
             tracks[i].reset();
         }
@@ -517,17 +446,7 @@ struct TWNC : Module {
             return;
         }
         
-        if (globalClockTriggered) {
-            if (secondsSinceLastClock > 0.0f) {
-                globalClockSeconds = secondsSinceLastClock;
-                globalClockSeconds = clamp(globalClockSeconds, 0.01f, 10.0f);
-            }
-            secondsSinceLastClock = 0.0f;
-        }
-        
-        if (secondsSinceLastClock >= 0.0f) {
-            secondsSinceLastClock += args.sampleTime;
-        }
+        clockPeriod.process(globalClockTriggered, args.sampleRate);
 
         int globalLength = (int)std::round(params[GLOBAL_LENGTH_PARAM].getValue());
         globalLength = clamp(globalLength, 1, 32);
@@ -561,7 +480,7 @@ struct TWNC : Module {
 
             generateTechnoEuclideanRhythm(track.pattern, track.length, track.fill, track.shift);
 
-            bool trackClockTrigger = track.processClockDivMult(globalClockTriggered, globalClockSeconds, args.sampleTime);
+            bool trackClockTrigger = track.clockDivMult.process(globalClockTriggered, clockPeriod.period(args.sampleRate), args.sampleRate);
 
             if (trackClockTrigger && globalClockActive) {
                 track.stepTrack();
@@ -599,7 +518,7 @@ struct TWNC : Module {
                 if (inputs[DRUM_FREQ_CV_INPUT].isConnected()) {
                     freqParam += inputs[DRUM_FREQ_CV_INPUT].getVoltage();
                 }
-                freqParam = std::pow(2.0f, freqParam);
+                freqParam = fastmath::exp2(freqParam);
                 float envelopeFM = envelopeOutput * fmAmount * 4.0f;
                 float totalFM = envelopeFM + processedFM;
                 
@@ -649,7 +568,7 @@ struct TWNC : Module {
                 if (inputs[HATS_FREQ_CV_INPUT].isConnected()) {
                     freqParam += inputs[HATS_FREQ_CV_INPUT].getVoltage();
                 }
-                freqParam = std::pow(2.0f, freqParam);
+                freqParam = fastmath::exp2(freqParam);
                 float audioOutput = sineVCO2.process(freqParam, noiseBlend);
                 
                 float vcaEnvelopeOutput = track.vcaEnvelope.process(args.sampleTime, triggerOutput, decayParam * 0.5f, shapeParam);
@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "ClockDivMult.hpp"
 
 struct TWNCLightDivMultParamQuantity : ParamQuantity {
     std::string getDisplayValueString() override {
@@ -150,8 +151,7 @@ struct TWNCLight : Module {
 
     dsp::SchmittTrigger clockTrigger;
 
-    float globalClockSeconds = 0.5f;
-    float secondsSinceLastClock = -1.0f;
+    divmult::ClockPeriod clockPeriod;
     int globalClockCount = 0;
 
     struct QuarterNoteClock {
@@ -183,16 +183,7 @@ struct TWNCLight : Module {
     };
 
     struct TrackState {
-        int divMultValue = 0;
-        int division = 1;
-        int multiplication = 1;
-        float dividedClockSeconds = 0.5f;
-        float multipliedClockSeconds = 0.5f;
-        float dividedProgressSeconds = 0.0f;
-        float gateSeconds = 0.0f;
-        int dividerCount = 0;
-        bool shouldStep = false;
-        bool prevMultipliedGate = false;
+        divmult::ClockDivMult clockDivMult;
 
         int currentStep = 0;
         int length = 16;
@@ -206,10 +197,7 @@ struct TWNCLight : Module {
         UnifiedEnvelope vcaEnvelope;
 
         void reset() {
-            dividedProgressSeconds = 0.0f;
-            dividerCount = 0;
-            shouldStep = false;
-            prevMultipliedGate = false;
+            clockDivMult.reset();
             currentStep = 0;
             for (int i = 0; i < 32; ++i) { pattern[i] = false; }
             gateState = false;
@@ -217,56 +205,6 @@ struct TWNCLight : Module {
             vcaEnvelope.reset();
         }
 
-        void updateDivMult(int divMultParam) {
-            divMultValue = divMultParam;
-            if (divMultParam > 0) {
-                division = 1;
-                multiplication = divMultParam + 1;
-            } else if (divMultParam < 0) {
-                division = -divMultParam + 1;
-                multiplication = 1;
-            } else {
-                division = 1;
-                multiplication = 1;
-            }
-        }
-
-        bool processClockDivMult(bool globalClock, float globalClockSeconds, float sampleTime) {
-            dividedClockSeconds = globalClockSeconds * (float)division;
-            multipliedClockSeconds = dividedClockSeconds / (float)multiplication;
-            gateSeconds = std::max(0.001f, multipliedClockSeconds * 0.5f);
-
-            if (globalClock) {
-                if (dividerCount < 1) {
-                    dividedProgressSeconds = 0.0f;
-                } else {
-                    dividedProgressSeconds += sampleTime;
-                }
-                ++dividerCount;
-                if (dividerCount >= division) {
-                    dividerCount = 0;
-                }
-            } else {
-                dividedProgressSeconds += sampleTime;
-            }
-
-            shouldStep = false;
-            if (dividedProgressSeconds < dividedClockSeconds) {
-                float multipliedProgressSeconds = dividedProgressSeconds / multipliedClockSeconds;
-                multipliedProgressSeconds -= (float)(int)multipliedProgressSeconds;
-                multipliedProgressSeconds *= multipliedClockSeconds;
-
-                bool currentMultipliedGate = multipliedProgressSeconds <= gateSeconds;
-
-                if (currentMultipliedGate && !prevMultipliedGate) {
-                    shouldStep = true;
-                }
-                prevMultipliedGate = currentMultipliedGate;
-            }
-
-            return shouldStep;
-        }
-
         void stepTrack() {
             currentStep = (currentStep + 1) % length;
             gateState = true && pattern[currentStep];
@@ -335,8 +273,7 @@ struct TWNCLight : Module {
     }
 
     void onReset() override {
-        secondsSinceLastClock = -1.0f;
-        globalClockSeconds = 0.5f;
+        clockPeriod.reset();
         globalClockCount = 0;
         for (int i = 0; i < 2; ++i) {
             tracks[i].reset();
@@ -367,18 +304,10 @@ struct TWNCLight : Module {
                     }
                     quarterClock.currentStep = 0;
                 }
-
-                if (secondsSinceLastClock > 0.0f) {
-                    globalClockSeconds = secondsSinceLastClock;
-                    globalClockSeconds = clamp(globalClockSeconds, 0.01f, 10.0f);
-                }
-                secondsSinceLastClock = 0.0f;
             }
         }
 
-        if (secondsSinceLastClock >= 0.0f) {
-            secondsSinceLastClock += args.sampleTime;
-        }
+        clockPeriod.process(globalClockTriggered, args.sampleRate);
 
         int globalLength = (int)std::round(params[GLOBAL_LENGTH_PARAM].getValue());
         globalLength = clamp(globalLength, 1, 32);
@@ -428,10 +357,10 @@ struct TWNCLight : Module {
             TrackState& track = tracks[i];
 
             if (i == 0) {
-                track.updateDivMult(0);
+                track.clockDivMult.setDivMult(0);
             } else {
                 int divMultParam = (int)std::round(params[TRACK2_DIVMULT_PARAM].getValue());
-                track.updateDivMult(divMultParam);
+                track.clockDivMult.setDivMult(divMultParam);
             }
 
             track.length = globalLength;
@@ -451,9 +380,9 @@ struct TWNCLight : Module {
 
             bool trackClockTrigger;
             if (i == 1) {
-                trackClockTrigger = track.processClockDivMult(hatsBaseClock, globalClockSeconds, args.sampleTime);
+                trackClockTrigger = track.clockDivMult.process(hatsBaseClock, clockPeriod.period(args.sampleRate), args.sampleRate);
             } else {
-                trackClockTrigger = track.processClockDivMult(globalClockTriggered, globalClockSeconds, args.sampleTime);
+                trackClockTrigger = track.clockDivMult.process(globalClockTriggered, clockPeriod.period(args.sampleRate), args.sampleRate);
             }
 
             if (trackClockTrigger && track.length > 0 && globalClockActive) {
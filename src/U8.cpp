@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "PolyBus.hpp"
 
 struct U8 : Module {
     enum ParamId {
@@ -27,14 +28,22 @@ struct U8 : Module {
         LIGHTS_LEN
     };
 
+    // Power-of-two ring so the read and write positions wrap with a mask.
+    // Frames hold all 16 channels side by side for float_4 access.
     static constexpr int DELAY_BUFFER_SIZE = 2048;
+    static constexpr int DELAY_MASK = DELAY_BUFFER_SIZE - 1;
     static constexpr int MAX_POLY = 16;
-    float delayBuffer[MAX_POLY][DELAY_BUFFER_SIZE];
-    int delayWriteIndex[MAX_POLY];
+    static_assert((DELAY_BUFFER_SIZE & DELAY_MASK) == 0, "delay buffer size must be a power of two");
+    alignas(16) float delayBuffer[DELAY_BUFFER_SIZE][MAX_POLY];
+    int delayWriteIndex = 0;
 
     bool muteState = false;
     dsp::SchmittTrigger muteTrigger;
 
+    // Sum the mixers to the left over the expander bus instead of the chain cables
+    bool expanderBus = false;
+    polybus::BusFrame busFrames[2];
+
     U8() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
 
@@ -55,15 +64,18 @@ struct U8 : Module {
 
         configLight(MUTE_LIGHT, "Mute Indicator");
 
-        for (int c = 0; c < MAX_POLY; c++) {
-            for (int i = 0; i < DELAY_BUFFER_SIZE; i++) {
-                delayBuffer[c][i] = 0.0f;
+        for (int i = 0; i < DELAY_BUFFER_SIZE; i++) {
+            for (int c = 0; c < MAX_POLY; c++) {
+                delayBuffer[i][c] = 0.0f;
             }
-            delayWriteIndex[c] = 0;
         }
+
+        polybus::attachBus(this, busFrames);
     }
 
     void process(const ProcessArgs& args) override {
+        using simd::float_4;
+
         // Handle mute trigger (monophonic)
         if (inputs[MUTE_TRIG_INPUT].isConnected()) {
             if (muteTrigger.process(inputs[MUTE_TRIG_INPUT].getVoltage())) {
@@ -75,18 +87,27 @@ struct U8 : Module {
         bool muted = params[MUTE_PARAM].getValue() > 0.5f;
         lights[MUTE_LIGHT].setBrightness(muted ? 1.0f : 0.0f);
 
-        // Get polyphonic channel counts
-        int leftChannels = inputs[LEFT_INPUT].getChannels();
-        int rightChannels = inputs[RIGHT_INPUT].getChannels();
-        int chainLeftChannels = inputs[CHAIN_LEFT_INPUT].getChannels();
-        int chainRightChannels = inputs[CHAIN_RIGHT_INPUT].getChannels();
+        // Cache connection state and channel counts once per block
+        polybus::PortState left, right, chainLeft, chainRight, duck, levelCv;
+        left.read(inputs[LEFT_INPUT]);
+        right.read(inputs[RIGHT_INPUT]);
+        chainLeft.read(inputs[CHAIN_LEFT_INPUT]);
+        chainRight.read(inputs[CHAIN_RIGHT_INPUT]);
+        duck.read(inputs[DUCK_INPUT]);
+        levelCv.read(inputs[LEVEL_CV_INPUT]);
+
+        // The left neighbour's output joins with the chain inputs.
+        // Cable chaining takes over whenever a chain input is patched.
+        bool joinsBus = expanderBus && !chainLeft.connected && !chainRight.connected;
+        const polybus::BusFrame* bus = joinsBus ? polybus::busInput(this) : nullptr;
+        int busChannels = bus ? bus->channels : 0;
 
         // Determine output channel count
-        int outputLeftChannels = std::max({leftChannels, chainLeftChannels, 1});
-        int outputRightChannels = std::max({rightChannels, chainRightChannels, 1});
+        int outputLeftChannels = std::max({left.channels, chainLeft.channels, busChannels, 1});
+        int outputRightChannels = std::max({right.channels, chainRight.channels, busChannels, 1});
 
         // If left is connected but right isn't, use delay for stereo effect
-        bool useDelay = inputs[LEFT_INPUT].isConnected() && !inputs[RIGHT_INPUT].isConnected();
+        bool useDelay = left.connected && !right.connected;
         if (useDelay) {
             outputRightChannels = outputLeftChannels;
         }
@@ -94,87 +115,72 @@ struct U8 : Module {
         outputs[LEFT_OUTPUT].setChannels(outputLeftChannels);
         outputs[RIGHT_OUTPUT].setChannels(outputRightChannels);
 
-        // Get duck and level parameters (can be polyphonic)
-        int duckChannels = inputs[DUCK_INPUT].getChannels();
-        int levelCvChannels = inputs[LEVEL_CV_INPUT].getChannels();
-
         float levelParam = params[LEVEL_PARAM].getValue();
         float duckAmount = params[DUCK_LEVEL_PARAM].getValue();
 
-        // Process left output channels
-        for (int c = 0; c < outputLeftChannels; c++) {
-            float leftInput = (c < leftChannels) ? inputs[LEFT_INPUT].getPolyVoltage(c) : 0.0f;
-            float chainLeftInput = (c < chainLeftChannels) ? inputs[CHAIN_LEFT_INPUT].getPolyVoltage(c) : 0.0f;
+        int delaySamples = clamp((int)(0.02f * args.sampleRate), 1, DELAY_BUFFER_SIZE - 1);
+        int readIndex = (delayWriteIndex - delaySamples) & DELAY_MASK;
 
-            // Apply ducking (use matching channel or channel 0)
-            float duckCV = 0.0f;
-            if (inputs[DUCK_INPUT].isConnected()) {
-                int duckChan = (c < duckChannels) ? c : 0;
-                duckCV = clamp(inputs[DUCK_INPUT].getPolyVoltage(duckChan) / 10.0f, 0.0f, 1.0f);
-            }
-            float sidechainCV = clamp(1.0f - (duckCV * duckAmount * 3.0f), 0.0f, 1.0f);
-
-            // Apply level control
-            float level = levelParam;
-            if (inputs[LEVEL_CV_INPUT].isConnected()) {
-                int levelChan = (c < levelCvChannels) ? c : 0;
-                float cvLevel = clamp(inputs[LEVEL_CV_INPUT].getPolyVoltage(levelChan) / 10.0f, 0.0f, 1.0f);
-                level = levelParam * cvLevel;
-            }
+        polybus::BusFrame* busFrame = polybus::busOutput(this);
 
-            leftInput *= level * sidechainCV;
+        // Four polyphonic channels per pass
+        int outputChannels = std::max(outputLeftChannels, outputRightChannels);
+        for (int c = 0; c < outputChannels; c += 4) {
+            float_4 leftInput = polybus::loadOrZero(inputs[LEFT_INPUT], left, c);
 
-            if (muted) {
-                leftInput = 0.0f;
+            float_4 rightInput;
+            if (useDelay) {
+                // Right is the left input 20 ms late; store before the gain is applied
+                rightInput = float_4::load(&delayBuffer[readIndex][c]) & polybus::laneMask(c, left.channels);
+                leftInput.store(&delayBuffer[delayWriteIndex][c]);
+            } else {
+                rightInput = polybus::loadOrZero(inputs[RIGHT_INPUT], right, c);
             }
 
-            outputs[LEFT_OUTPUT].setVoltage(leftInput + chainLeftInput, c);
-        }
-
-        // Process right output channels
-        for (int c = 0; c < outputRightChannels; c++) {
-            float rightInput = 0.0f;
-
-            if (useDelay && c < leftChannels) {
-                // Use delay for right channel when only left is connected
-                int delaySamples = (int)(0.02f * args.sampleRate);
-                delaySamples = clamp(delaySamples, 1, DELAY_BUFFER_SIZE - 1);
-
-                int readIndex = (delayWriteIndex[c] - delaySamples + DELAY_BUFFER_SIZE) % DELAY_BUFFER_SIZE;
-                rightInput = delayBuffer[c][readIndex];
-
-                // Store left input in delay buffer
-                delayBuffer[c][delayWriteIndex[c]] = inputs[LEFT_INPUT].getPolyVoltage(c);
-                delayWriteIndex[c] = (delayWriteIndex[c] + 1) % DELAY_BUFFER_SIZE;
-            } else if (c < rightChannels) {
-                rightInput = inputs[RIGHT_INPUT].getPolyVoltage(c);
+            // Ducking and level CV use the matching channel or channel 0
+            float_4 gain = 0.f;
+            if (!muted) {
+                float_4 duckCV = 0.f;
+                if (duck.connected) {
+                    duckCV = simd::clamp(polybus::loadOrFirst(inputs[DUCK_INPUT], duck, c) / 10.f, 0.f, 1.f);
+                }
+                float_4 sidechainCV = simd::clamp(1.f - duckCV * duckAmount * 3.f, 0.f, 1.f);
+
+                float_4 level = levelParam;
+                if (levelCv.connected) {
+                    level *= simd::clamp(polybus::loadOrFirst(inputs[LEVEL_CV_INPUT], levelCv, c) / 10.f, 0.f, 1.f);
+                }
+
+                gain = level * sidechainCV;
             }
 
-            float chainRightInput = (c < chainRightChannels) ? inputs[CHAIN_RIGHT_INPUT].getPolyVoltage(c) : 0.0f;
+            float_4 chainLeftInput = polybus::loadOrZero(inputs[CHAIN_LEFT_INPUT], chainLeft, c);
+            float_4 chainRightInput = polybus::loadOrZero(inputs[CHAIN_RIGHT_INPUT], chainRight, c);
 
-            // Apply ducking
-            float duckCV = 0.0f;
-            if (inputs[DUCK_INPUT].isConnected()) {
-                int duckChan = (c < duckChannels) ? c : 0;
-                duckCV = clamp(inputs[DUCK_INPUT].getPolyVoltage(duckChan) / 10.0f, 0.0f, 1.0f);
-            }
-            float sidechainCV = clamp(1.0f - (duckCV * duckAmount * 3.0f), 0.0f, 1.0f);
-
-            // Apply level control
-            float level = levelParam;
-            if (inputs[LEVEL_CV_INPUT].isConnected()) {
-                int levelChan = (c < levelCvChannels) ? c : 0;
-                float cvLevel = clamp(inputs[LEVEL_CV_INPUT].getPolyVoltage(levelChan) / 10.0f, 0.0f, 1.0f);
-                level = levelParam * cvLevel;
+            if (bus) {
+                chainLeftInput += polybus::busOrZero(bus->left, busChannels, c);
+                chainRightInput += polybus::busOrZero(bus->right, busChannels, c);
             }
 
-            rightInput *= level * sidechainCV;
+            float_4 mixLeft = leftInput * gain + chainLeftInput;
+            float_4 mixRight = rightInput * gain + chainRightInput;
+
+            outputs[LEFT_OUTPUT].setVoltageSimd(mixLeft, c);
+            outputs[RIGHT_OUTPUT].setVoltageSimd(mixRight, c);
 
-            if (muted) {
-                rightInput = 0.0f;
+            // The right neighbour receives exactly what leaves the mix outputs
+            if (busFrame) {
+                mixLeft.store(busFrame->left + c);
+                mixRight.store(busFrame->right + c);
             }
+        }
 
-            outputs[RIGHT_OUTPUT].setVoltage(rightInput + chainRightInput, c);
+        if (busFrame) {
+            polybus::publishBus(this, busFrame, outputChannels);
+        }
+
+        if (useDelay) {
+            delayWriteIndex = (delayWriteIndex + 1) & DELAY_MASK;
         }
     }
 
@@ -182,17 +188,60 @@ struct U8 : Module {
         int chainLeftChannels = inputs[CHAIN_LEFT_INPUT].getChannels();
         int chainRightChannels = inputs[CHAIN_RIGHT_INPUT].getChannels();
 
+        // Bypassed mixers relay their chain, from the cables or the bus
+        const polybus::BusFrame* bus = nullptr;
+        if (expanderBus && chainLeftChannels == 0 && chainRightChannels == 0) {
+            bus = polybus::busInput(this);
+            if (bus) {
+                chainLeftChannels = bus->channels;
+                chainRightChannels = bus->channels;
+            }
+        }
+
         outputs[LEFT_OUTPUT].setChannels(chainLeftChannels);
         outputs[RIGHT_OUTPUT].setChannels(chainRightChannels);
 
-        for (int c = 0; c < chainLeftChannels; c++) {
-            outputs[LEFT_OUTPUT].setVoltage(inputs[CHAIN_LEFT_INPUT].getPolyVoltage(c), c);
+        polybus::BusFrame* busFrame = polybus::busOutput(this);
+        int maxChannels = std::max(chainLeftChannels, chainRightChannels);
+        for (int c = 0; c < maxChannels; c++) {
+            float chainL = 0.0f, chainR = 0.0f;
+            if (bus) {
+                chainL = bus->left[c];
+                chainR = bus->right[c];
+            } else {
+                if (c < chainLeftChannels)
+                    chainL = inputs[CHAIN_LEFT_INPUT].getPolyVoltage(c);
+                if (c < chainRightChannels)
+                    chainR = inputs[CHAIN_RIGHT_INPUT].getPolyVoltage(c);
+            }
+
+            if (c < chainLeftChannels)
+                outputs[LEFT_OUTPUT].setVoltage(chainL, c);
+            if (c < chainRightChannels)
+                outputs[RIGHT_OUTPUT].setVoltage(chainR, c);
+
+            if (busFrame) {
+                busFrame->left[c] = chainL;
+                busFrame->right[c] = chainR;
+            }
         }
 
-        for (int c = 0; c < chainRightChannels; c++) {
-            outputs[RIGHT_OUTPUT].setVoltage(inputs[CHAIN_RIGHT_INPUT].getPolyVoltage(c), c);
+        if (busFrame) {
+            polybus::publishBus(this, busFrame, maxChannels);
         }
     }
+
+    json_t* dataToJson() override {
+        json_t* root = json_object();
+        json_object_set_new(root, "expanderBus", json_boolean(expanderBus));
+        return root;
+    }
+
+    void dataFromJson(json_t* root) override {
+        json_t* expanderBusJ = json_object_get(root, "expanderBus");
+        if (expanderBusJ)
+            expanderBus = json_boolean_value(expanderBusJ);
+    }
 };
 
 struct U8Widget : ModuleWidget {
@@ -222,6 +271,14 @@ struct U8Widget : ModuleWidget {
         addOutput(createOutputCentered<PJ301MPort>(Vec(centerX + 15, 343), module, U8::LEFT_OUTPUT));
         addOutput(createOutputCentered<PJ301MPort>(Vec(centerX + 15, 368), module, U8::RIGHT_OUTPUT));
     }
+
+    void appendContextMenu(ui::Menu* menu) override {
+        U8* module = getModule<U8>();
+        if (!module) return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createBoolPtrMenuItem("Sum mixers on the left via expander", "", &module->expanderBus));
+    }
 };
 
 Model* modelU8 = createModel<U8, U8Widget>("U8");
\ No newline at end of file
@@ -1,4 +1,7 @@
 #include "plugin.hpp"
+#include <atomic>
+#include "ChowDSP.hpp"
+#include "FastMath.hpp"
 #include "WorldRhythm/PatternGenerator.hpp"
 #include "WorldRhythm/HumanizeEngine.hpp"
 #include "WorldRhythm/StyleProfiles.hpp"
@@ -12,6 +15,7 @@
 #include "WorldRhythm/CrossRhythmEngine.hpp"
 #include "WorldRhythm/AsymmetricGroupingEngine.hpp"
 #include "WorldRhythm/AmenBreakEngine.hpp"
+#include "WorldRhythm/EventScheduler.hpp"
 
 // ============================================================================
 // Uni Rhythm Module - 32HP (MetaModule port)
@@ -84,129 +88,11 @@ public:
     }
 };
 
-// 8-voice style presets
-struct URExtendedStylePreset {
-    struct VoicePreset {
-        SynthMode mode;
-        float freq;
-        float decay;
-        const char* name;
-        float sweep = 0.f;
-        float bend = 1.f;
-    };
-    VoicePreset voices[8];
-};
-
-// Voice assignments per style (2 voices per role):
-// 0-1: Timeline, 2-3: Foundation, 4-5: Groove, 6-7: Lead
-
-static const URExtendedStylePreset UR_EXTENDED_PRESETS[10] = {
-    // 0: West African
-    {{{SynthMode::SINE, 4500.0f, 60.0f, "Gankogui"},
-      {SynthMode::SINE, 3500.0f, 40.0f, "Bell Lo"},
-      {SynthMode::SINE, 80.0f, 200.0f, "Dununba"},
-      {SynthMode::SINE, 120.0f, 150.0f, "Dunun"},
-      {SynthMode::SINE, 250.0f, 80.0f, "Sangban"},
-      {SynthMode::SINE, 300.0f, 60.0f, "Kenkeni"},
-      {SynthMode::NOISE, 700.0f, 40.0f, "Djembe Slap"},
-      {SynthMode::NOISE, 400.0f, 50.0f, "Djembe Tone"}}},
-
-    // 1: Afro-Cuban
-    {{{SynthMode::SINE, 4000.0f, 20.0f, "Clave"},
-      {SynthMode::SINE, 2000.0f, 30.0f, "Cowbell"},
-      {SynthMode::SINE, 100.0f, 150.0f, "Tumba"},
-      {SynthMode::SINE, 150.0f, 120.0f, "Conga Lo"},
-      {SynthMode::SINE, 350.0f, 70.0f, "Conga Mid"},
-      {SynthMode::SINE, 550.0f, 50.0f, "Quinto"},
-      {SynthMode::NOISE, 3000.0f, 40.0f, "Timbales"},
-      {SynthMode::NOISE, 5000.0f, 25.0f, "Quinto Slap"}}},
-
-    // 2: Brazilian
-    {{{SynthMode::SINE, 4500.0f, 35.0f, "Agogo Hi"},
-      {SynthMode::SINE, 3000.0f, 35.0f, "Agogo Lo"},
-      {SynthMode::SINE, 55.0f, 250.0f, "Surdo"},
-      {SynthMode::SINE, 80.0f, 180.0f, "Surdo 2"},
-      {SynthMode::SINE, 400.0f, 40.0f, "Tamborim"},
-      {SynthMode::NOISE, 500.0f, 50.0f, "Caixa"},
-      {SynthMode::NOISE, 6000.0f, 30.0f, "Ganza"},
-      {SynthMode::NOISE, 8000.0f, 20.0f, "Chocalho"}}},
-
-    // 3: Balkan
-    {{{SynthMode::NOISE, 4000.0f, 25.0f, "Rim"},
-      {SynthMode::NOISE, 3500.0f, 15.0f, "Click"},
-      {SynthMode::SINE, 90.0f, 180.0f, "Tapan Bass"},
-      {SynthMode::SINE, 130.0f, 120.0f, "Tapan Mid"},
-      {SynthMode::SINE, 300.0f, 50.0f, "Tarabuka Doum"},
-      {SynthMode::SINE, 450.0f, 35.0f, "Tarabuka Tek"},
-      {SynthMode::NOISE, 3000.0f, 25.0f, "Tek Hi"},
-      {SynthMode::NOISE, 5000.0f, 20.0f, "Ka"}}},
-
-    // 4: Indian
-    {{{SynthMode::NOISE, 8000.0f, 150.0f, "Manjira"},
-      {SynthMode::NOISE, 6000.0f, 100.0f, "Ghungroo"},
-      {SynthMode::SINE, 65.0f, 300.0f, "Baya Ge"},
-      {SynthMode::SINE, 90.0f, 200.0f, "Baya Ka"},
-      {SynthMode::SINE, 350.0f, 100.0f, "Daya Na"},
-      {SynthMode::SINE, 500.0f, 80.0f, "Daya Tin"},
-      {SynthMode::NOISE, 1500.0f, 60.0f, "Daya Ti"},
-      {SynthMode::NOISE, 2500.0f, 40.0f, "Daya Re"}}},
-
-    // 5: Gamelan
-    {{{SynthMode::SINE, 700.0f, 400.0f, "Kenong"},
-      {SynthMode::SINE, 600.0f, 350.0f, "Kethuk"},
-      {SynthMode::SINE, 90.0f, 800.0f, "Gong"},
-      {SynthMode::SINE, 150.0f, 500.0f, "Kempul"},
-      {SynthMode::SINE, 800.0f, 200.0f, "Bonang Po"},
-      {SynthMode::SINE, 1000.0f, 180.0f, "Bonang Sa"},
-      {SynthMode::SINE, 1200.0f, 250.0f, "Gender"},
-      {SynthMode::SINE, 1400.0f, 220.0f, "Saron"}}},
-
-    // 6: Jazz
-    {{{SynthMode::NOISE, 4500.0f, 120.0f, "Ride"},
-      {SynthMode::NOISE, 2500.0f, 80.0f, "Ride Bell"},
-      {SynthMode::SINE, 50.0f, 200.0f, "Kick"},
-      {SynthMode::SINE, 80.0f, 150.0f, "Kick Ghost"},
-      {SynthMode::NOISE, 500.0f, 100.0f, "Snare"},
-      {SynthMode::NOISE, 400.0f, 60.0f, "Snare Ghost"},
-      {SynthMode::NOISE, 8000.0f, 35.0f, "HiHat Cl"},
-      {SynthMode::NOISE, 6000.0f, 150.0f, "HiHat Op"}}},
-
-    // 7: Electronic
-    {{{SynthMode::NOISE, 9000.0f, 30.0f, "HiHat"},
-      {SynthMode::NOISE, 12000.0f, 20.0f, "HiHat Ac"},
-      {SynthMode::SINE, 45.0f, 280.0f, "808 Kick", 120.f, 0.8f},
-      {SynthMode::SINE, 60.0f, 200.0f, "Kick 2", 80.f, 1.0f},
-      {SynthMode::NOISE, 1500.0f, 70.0f, "Clap"},
-      {SynthMode::NOISE, 2500.0f, 50.0f, "Snare"},
-      {SynthMode::NOISE, 6000.0f, 150.0f, "Open HH"},
-      {SynthMode::SINE, 800.0f, 100.0f, "Perc"}}},
-
-    // 8: Breakbeat
-    {{{SynthMode::NOISE, 8000.0f, 25.0f, "HiHat"},
-      {SynthMode::NOISE, 10000.0f, 15.0f, "HiHat Ac"},
-      {SynthMode::SINE, 55.0f, 180.0f, "Kick", 140.f, 1.0f},
-      {SynthMode::SINE, 70.0f, 120.0f, "Kick Gho", 60.f, 1.2f},
-      {SynthMode::NOISE, 2500.0f, 80.0f, "Snare"},
-      {SynthMode::NOISE, 2000.0f, 50.0f, "Snare Gh"},
-      {SynthMode::NOISE, 4000.0f, 40.0f, "Ghost"},
-      {SynthMode::NOISE, 6000.0f, 100.0f, "Open HH"}}},
-
-    // 9: Techno
-    {{{SynthMode::NOISE, 10000.0f, 20.0f, "HiHat"},
-      {SynthMode::NOISE, 12000.0f, 12.0f, "HiHat Ac"},
-      {SynthMode::SINE, 42.0f, 250.0f, "909 Kick", 160.f, 1.2f},
-      {SynthMode::SINE, 55.0f, 180.0f, "Kick Lay", 100.f, 1.0f},
-      {SynthMode::NOISE, 1800.0f, 55.0f, "Clap"},
-      {SynthMode::NOISE, 3000.0f, 35.0f, "Rim"},
-      {SynthMode::NOISE, 5000.0f, 80.0f, "Open HH"},
-      {SynthMode::SINE, 600.0f, 60.0f, "Tom"}}}
-};
-
 // Apply preset for specific role (2 voices)
 inline void urApplyRolePreset(URExtendedDrumSynth& synth, int role, int styleIndex) {
     if (styleIndex < 0 || styleIndex > 9) return;
     if (role < 0 || role > 3) return;
-    const URExtendedStylePreset& preset = UR_EXTENDED_PRESETS[styleIndex];
+    const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
     int voiceBase = role * 2;
     synth.setVoiceParams(voiceBase, preset.voices[voiceBase].mode,
                          preset.voices[voiceBase].freq, preset.voices[voiceBase].decay,
@@ -218,158 +104,185 @@ inline void urApplyRolePreset(URExtendedDrumSynth& synth, int role, int styleInd
 
 // ============================================================================
 // ThreeBandIsolator - Linkwitz-Riley 4th order crossover (UniRhythm namespace)
+// L/R run together in float_4 lanes: the 250 Hz bank yields
+// {low L, low R, mid L, mid R}, the 4 kHz bank takes the input and that mid
+// path and yields {high L, high R, mid L, mid R}.
 // ============================================================================
 
 class URThreeBandIsolator {
 private:
-    float sampleRate = 44100.0f;
+    using float_4 = simd::float_4;
+    using Section = chowdsp::IIRFilter<3, float_4>;
 
-    struct Biquad {
-        float a0 = 0, a1 = 0, a2 = 0, b1 = 0, b2 = 0;
-        float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    struct Coeffs {
+        float b[3], a[3];
+    };
 
-        void reset() { x1 = x2 = y1 = y2 = 0; }
+    float sampleRate = 44100.0f;
 
-        float process(float in) {
-            float out = a0 * in + a1 * x1 + a2 * x2 - b1 * y1 - b2 * y2;
-            x2 = x1; x1 = in;
-            y2 = y1; y1 = out;
-            return out;
-        }
-    };
+    Section lowSplit[2];   // LP | LP | HP | HP at 250 Hz, two sections per LR4
+    Section highSplit[2];  // HP | HP | LP | LP at 4 kHz
 
-    Biquad lpLow1[2], lpLow2[2];
-    Biquad hpLow1[2], hpLow2[2];
-    Biquad lpHigh1[2], lpHigh2[2];
-    Biquad hpHigh1[2], hpHigh2[2];
+    float lastLowParam = NAN, lastMidParam = NAN, lastHighParam = NAN;
+    float_4 lowSplitGain = 0.0f;
+    float_4 highSplitGain = 0.0f;
 
-    void calcButterworth2LP(Biquad& bq, float fc) {
+    Coeffs calcButterworth2(float fc, bool highpass) const {
         float w0 = 2.0f * M_PI * fc / sampleRate;
         float cosw0 = std::cos(w0);
         float sinw0 = std::sin(w0);
         float alpha = sinw0 / std::sqrt(2.0f);
         float norm = 1.0f / (1.0f + alpha);
-        bq.a0 = (1.0f - cosw0) * 0.5f * norm;
-        bq.a1 = (1.0f - cosw0) * norm;
-        bq.a2 = bq.a0;
-        bq.b1 = -2.0f * cosw0 * norm;
-        bq.b2 = (1.0f - alpha) * norm;
+        Coeffs c;
+        if (highpass) {
+            c.b[0] = (1.0f + cosw0) * 0.5f * norm;
+            c.b[1] = -(1.0f + cosw0) * norm;
+        } else {
+            c.b[0] = (1.0f - cosw0) * 0.5f * norm;
+            c.b[1] = (1.0f - cosw0) * norm;
+        }
+        c.b[2] = c.b[0];
+        c.a[0] = 1.0f;
+        c.a[1] = -2.0f * cosw0 * norm;
+        c.a[2] = (1.0f - alpha) * norm;
+        return c;
     }
 
-    void calcButterworth2HP(Biquad& bq, float fc) {
-        float w0 = 2.0f * M_PI * fc / sampleRate;
-        float cosw0 = std::cos(w0);
-        float sinw0 = std::sin(w0);
-        float alpha = sinw0 / std::sqrt(2.0f);
-        float norm = 1.0f / (1.0f + alpha);
-        bq.a0 = (1.0f + cosw0) * 0.5f * norm;
-        bq.a1 = -(1.0f + cosw0) * norm;
-        bq.a2 = bq.a0;
-        bq.b1 = -2.0f * cosw0 * norm;
-        bq.b2 = (1.0f - alpha) * norm;
+    void designSplit(Section& section, float fc, bool lowLanesHighpass) {
+        Coeffs first = calcButterworth2(fc, lowLanesHighpass);
+        Coeffs second = calcButterworth2(fc, !lowLanesHighpass);
+        float_4 b[3], a[3];
+        for (int k = 0; k < 3; k++) {
+            b[k] = float_4(first.b[k], first.b[k], second.b[k], second.b[k]);
+            a[k] = float_4(first.a[k], first.a[k], second.a[k], second.a[k]);
+        }
+        section.setCoefficients(b, a);
+    }
+
+    static float paramToGain(float p) {
+        if (p < 0) {
+            float t = 1.0f + p;
+            return t * t;
+        }
+        return 1.0f + p * 3.0f;
     }
 
 public:
     void setSampleRate(float sr) {
         sampleRate = sr;
-        for (int ch = 0; ch < 2; ch++) {
-            calcButterworth2LP(lpLow1[ch], 250.0f);
-            calcButterworth2LP(lpLow2[ch], 250.0f);
-            calcButterworth2HP(hpLow1[ch], 250.0f);
-            calcButterworth2HP(hpLow2[ch], 250.0f);
-            calcButterworth2LP(lpHigh1[ch], 4000.0f);
-            calcButterworth2LP(lpHigh2[ch], 4000.0f);
-            calcButterworth2HP(hpHigh1[ch], 4000.0f);
-            calcButterworth2HP(hpHigh2[ch], 4000.0f);
+        for (int i = 0; i < 2; i++) {
+            designSplit(lowSplit[i], 250.0f, false);
+            designSplit(highSplit[i], 4000.0f, true);
         }
         reset();
     }
 
     void reset() {
-        for (int ch = 0; ch < 2; ch++) {
-            lpLow1[ch].reset(); lpLow2[ch].reset();
-            hpLow1[ch].reset(); hpLow2[ch].reset();
-            lpHigh1[ch].reset(); lpHigh2[ch].reset();
-            hpHigh1[ch].reset(); hpHigh2[ch].reset();
+        for (int i = 0; i < 2; i++) {
+            lowSplit[i].reset();
+            highSplit[i].reset();
         }
     }
 
     void process(float& left, float& right, float lowParam, float midParam, float highParam) {
-        auto paramToGain = [](float p) {
-            if (p < 0) {
-                float t = 1.0f + p;
-                return t * t;
-            } else {
-                return 1.0f + p * 3.0f;
-            }
-        };
-
-        float gainLow = paramToGain(lowParam);
-        float gainMid = paramToGain(midParam);
-        float gainHigh = paramToGain(highParam);
-
-        float ins[2] = {left, right};
-        float outs[2];
-
-        for (int ch = 0; ch < 2; ch++) {
-            float in = ins[ch];
-            float low = lpLow2[ch].process(lpLow1[ch].process(in));
-            float high = hpHigh2[ch].process(hpHigh1[ch].process(in));
-            float midTemp = hpLow2[ch].process(hpLow1[ch].process(in));
-            float mid = lpHigh2[ch].process(lpHigh1[ch].process(midTemp));
-            outs[ch] = low * gainLow + mid * gainMid + high * gainHigh;
+        if (lowParam != lastLowParam || midParam != lastMidParam || highParam != lastHighParam) {
+            lastLowParam = lowParam;
+            lastMidParam = midParam;
+            lastHighParam = highParam;
+            float gainLow = paramToGain(lowParam);
+            float gainMid = paramToGain(midParam);
+            float gainHigh = paramToGain(highParam);
+            lowSplitGain = float_4(gainLow, gainLow, 0.0f, 0.0f);
+            highSplitGain = float_4(gainHigh, gainHigh, gainMid, gainMid);
         }
 
-        left = outs[0];
-        right = outs[1];
+        float_4 low = lowSplit[1].process(lowSplit[0].process(float_4(left, right, left, right)));
+        float_4 high = highSplit[1].process(highSplit[0].process(float_4(left, right, low[2], low[3])));
+        float_4 out = low * lowSplitGain + high * highSplitGain;
+
+        left = out[0] + out[2];
+        right = out[1] + out[3];
     }
 };
 
 // ============================================================================
 // TubeDrive - Asymmetric tube saturation with DC blocker (UniRhythm namespace)
+// L/R share one float_4, optionally oversampled 2x or 4x
 // ============================================================================
 
 class URTubeDrive {
 private:
+    using float_4 = simd::float_4;
+
     float sampleRate = 44100.0f;
-    float dcBlockerL = 0, dcBlockerR = 0;
+    float_4 dcBlocker = 0.0f;
+    float_4 dcPrev = 0.0f;
     float dcCoeff = 0.999f;
 
+    chowdsp::VariableOversampling<4, float_4> oversampler;
+    int oversamplingIndex = 1;  // 2x, what process() runs at
+    std::atomic<int> requestedIndex{1};  // set from the menu or patch, applied on the audio thread
+
+    static float_4 tubeShape(float_4 x, float drive) {
+        float_4 scaled = x * (1.0f + drive * 2.0f);
+        scaled = simd::ifelse(scaled >= 0.0f, scaled * 0.8f, scaled);
+        return fastmath::tanh(scaled);
+    }
+
 public:
+    URTubeDrive() {
+        oversampler.setOversamplingIndex(oversamplingIndex);
+    }
+
     void setSampleRate(float sr) {
         sampleRate = sr;
         float fc = 10.0f;
         dcCoeff = 1.0f - (2.0f * M_PI * fc / sr);
         if (dcCoeff < 0.9f) dcCoeff = 0.9f;
         if (dcCoeff > 0.9999f) dcCoeff = 0.9999f;
+        oversampler.reset(sr);
+    }
+
+    // 0 = off, 1 = 2x, 2 = 4x. Safe from any thread, takes effect on the next process()
+    void setOversamplingIndex(int index) {
+        requestedIndex = clamp(index, 0, 2);
+    }
+
+    int getOversamplingIndex() const {
+        return requestedIndex;
     }
 
     void reset() {
-        dcBlockerL = dcBlockerR = 0;
+        dcBlocker = 0.0f;
+        dcPrev = 0.0f;
     }
 
     void process(float& left, float& right, float driveAmount) {
+        int requested = requestedIndex;
+        if (requested != oversamplingIndex) {
+            oversamplingIndex = requested;
+            oversampler.setOversamplingIndex(oversamplingIndex);
+            oversampler.reset(sampleRate);
+        }
+
         if (driveAmount < 0.01f) return;
 
-        auto tubeShape = [](float x, float drive) {
-            float scaled = x * (1.0f + drive * 2.0f);
-            if (scaled >= 0) {
-                return std::tanh(scaled * 0.8f);
-            } else {
-                return std::tanh(scaled * 1.0f);
-            }
-        };
-
-        float makeupGain = 1.0f / (1.0f + driveAmount * 0.5f);
-        left = tubeShape(left, driveAmount) * makeupGain;
-        right = tubeShape(right, driveAmount) * makeupGain;
-
-        float prevL = dcBlockerL;
-        float prevR = dcBlockerR;
-        dcBlockerL = left - prevL + dcCoeff * dcBlockerL;
-        dcBlockerR = right - prevR + dcCoeff * dcBlockerR;
-        left = dcBlockerL;
-        right = dcBlockerR;
+        float_4 x(left, right, 0.0f, 0.0f);
+        if (oversamplingIndex == 0) {
+            x = tubeShape(x, driveAmount);
+        } else {
+            oversampler.upsample(x);
+            float_4* osBuffer = oversampler.getOSBuffer();
+            for (int k = 0; k < oversampler.getOversamplingRatio(); k++)
+                osBuffer[k] = tubeShape(osBuffer[k], driveAmount);
+            x = oversampler.downsample();
+        }
+        x *= 1.0f / (1.0f + driveAmount * 0.5f);
+
+        dcBlocker = x - dcPrev + dcCoeff * dcBlocker;
+        dcPrev = x;
+        left = dcBlocker[0];
+        right = dcBlocker[1];
     }
 };
 
@@ -545,6 +458,9 @@ struct UniRhythm : Module {
     int currentSteps[4] = {0, 0, 0, 0};
     int currentBar = 0;
     float appliedRest = 0.0f;
+    WorldRhythm::RestRanks restRanks[8];  // per-voice rest order, ranked at generation
+    uint32_t appliedRestMasks[8] = {};
+    uint32_t patternSeed = 0;  // advanced by REGENERATE/VARIATION, keys the pattern cache (generator output only)
 
     // Cached synth parameters
     float cachedFreqs[8] = {0};
@@ -586,19 +502,23 @@ struct UniRhythm : Module {
     int ppqn = 4;
     int ppqnCounter = 0;
 
-    // Flam/Drag delayed trigger support (fixed array)
+    // Flam/Drag delayed trigger support (fixed-capacity heap on an absolute sample clock)
     static constexpr int MAX_DELAYED_TRIGGERS = 64;
     struct DelayedTrigger {
-        float samplesRemaining = 0;
+        uint64_t due = 0;
         int voice = -1;
         float velocity = 0;
+        float vcaDecayMs = 200.0f;  // captured when scheduled
         bool isAccent = false;
         int role = 0;
         bool isStrongBeat = false;
         bool isSubNote = false;
     };
-    DelayedTrigger delayedTriggers[MAX_DELAYED_TRIGGERS];
-    int delayedTriggerCount = 0;
+    WorldRhythm::EventScheduler<DelayedTrigger, MAX_DELAYED_TRIGGERS> delayedTriggers;
+    uint64_t sampleClock = 0;
+
+    // Delays count from the next process() call, rounded up to whole samples
+    uint64_t dueAfter(float delaySamples) const { return sampleClock + static_cast<uint64_t>(std::ceil(delaySamples)); }
 
     // Change detection
     int lastStyles[4] = {-1, -1, -1, -1};
@@ -847,7 +767,7 @@ struct UniRhythm : Module {
                     currentFreqs[voiceIdx] = newFreq;
                     int styleIndex = lastStyles[role];
                     if (styleIndex >= 0 && styleIndex <= 9) {
-                        const unirhythm::URExtendedStylePreset& preset = unirhythm::UR_EXTENDED_PRESETS[styleIndex];
+                        const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
                         drumSynth.setVoiceParams(voiceIdx, preset.voices[voiceIdx].mode, newFreq, newDecay,
                                                  cachedSweeps[voiceIdx], cachedBends[voiceIdx]);
                     }
@@ -974,13 +894,13 @@ struct UniRhythm : Module {
             originalPatterns.patterns[r*2] = patterns.patterns[r*2];
             originalPatterns.patterns[r*2+1] = patterns.patterns[r*2+1];
 
-            if (restAmount > 0.01f) {
-                restEngine.setStyle(styleIndex);
-                restEngine.applyRest(patterns.patterns[r*2], roleType, restAmount);
-                restEngine.applyRest(patterns.patterns[r*2+1], roleType, restAmount);
-            }
+            restEngine.setStyle(styleIndex);
+            restRanks[r*2] = restEngine.rankRest(originalPatterns.patterns[r*2], roleType);
+            restRanks[r*2+1] = restEngine.rankRest(originalPatterns.patterns[r*2+1], roleType);
+            applyRestToVoice(r*2, restAmount);
+            applyRestToVoice(r*2+1, restAmount);
 
-            const unirhythm::URExtendedStylePreset& preset = unirhythm::UR_EXTENDED_PRESETS[styleIndex];
+            const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
             int vb = r * 2;
             cachedFreqs[vb] = preset.voices[vb].freq; cachedFreqs[vb+1] = preset.voices[vb+1].freq;
             cachedDecays[vb] = preset.voices[vb].decay; cachedDecays[vb+1] = preset.voices[vb+1].decay;
@@ -1013,7 +933,7 @@ struct UniRhythm : Module {
             patterns.patterns[role*2] = WorldRhythm::Pattern(length);
             patterns.patterns[role*2+1] = WorldRhythm::Pattern(length);
             roleLengths[role] = length; lastStyles[role] = styleIndex; lastDensities[role] = density; lastLengths[role] = length;
-            const unirhythm::URExtendedStylePreset& preset = unirhythm::UR_EXTENDED_PRESETS[styleIndex];
+            const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
             int vb = role * 2;
             cachedFreqs[vb] = preset.voices[vb].freq; cachedFreqs[vb+1] = preset.voices[vb+1].freq;
             cachedDecays[vb] = preset.voices[vb].decay; cachedDecays[vb+1] = preset.voices[vb+1].decay;
@@ -1037,19 +957,19 @@ struct UniRhythm : Module {
         WorldRhythm::Role roleType = static_cast<WorldRhythm::Role>(role);
 
         if (role == WorldRhythm::TIMELINE) {
-            patterns.patterns[role*2] = patternGen.generate(roleType, style, length, density, variation);
+            patterns.patterns[role*2] = patternGen.generateCached(roleType, styleIndex, length, density, variation, patternSeed);
         } else if (role == WorldRhythm::FOUNDATION) {
             WorldRhythm::PatternGenerator::InterlockConfig cfg = WorldRhythm::PatternGenerator::getStyleInterlockConfig(styleIndex);
-            if (cfg.avoidFoundationOnTimeline) patterns.patterns[role*2] = patternGen.generateFoundationWithInterlock(style, length, density, variation, patterns.patterns[0], cfg.avoidanceStrength);
-            else patterns.patterns[role*2] = patternGen.generateFoundation(style, length, density, variation);
+            if (cfg.avoidFoundationOnTimeline) patterns.patterns[role*2] = patternGen.generateFoundationWithInterlockCached(styleIndex, length, density, variation, patterns.patterns[0], patternSeed);
+            else patterns.patterns[role*2] = patternGen.generateCached(roleType, styleIndex, length, density, variation, patternSeed);
         } else if (role == WorldRhythm::GROOVE) {
             WorldRhythm::PatternGenerator::InterlockConfig cfg = WorldRhythm::PatternGenerator::getStyleInterlockConfig(styleIndex);
-            if (cfg.grooveComplementsFoundation) patterns.patterns[role*2] = patternGen.generateGrooveWithComplement(style, length, density, variation, patterns.patterns[2], patterns.patterns[0], cfg);
-            else patterns.patterns[role*2] = patternGen.generate(roleType, style, length, density, variation);
+            if (cfg.grooveComplementsFoundation) patterns.patterns[role*2] = patternGen.generateGrooveWithComplementCached(styleIndex, length, density, variation, patterns.patterns[2], patterns.patterns[0], patternSeed);
+            else patterns.patterns[role*2] = patternGen.generateCached(roleType, styleIndex, length, density, variation, patternSeed);
         } else {
             WorldRhythm::PatternGenerator::InterlockConfig cfg = WorldRhythm::PatternGenerator::getStyleInterlockConfig(styleIndex);
-            if (cfg.leadAvoidsGroove) patterns.patterns[role*2] = patternGen.generateWithInterlock(roleType, style, length, density*0.6f, variation, patterns.patterns[4]);
-            else patterns.patterns[role*2] = patternGen.generate(roleType, style, length, density*0.6f, variation);
+            if (cfg.leadAvoidsGroove) patterns.patterns[role*2] = patternGen.generateWithInterlockCached(roleType, styleIndex, length, density*0.6f, variation, patterns.patterns[4], patternSeed);
+            else patterns.patterns[role*2] = patternGen.generateCached(roleType, styleIndex, length, density*0.6f, variation, patternSeed);
         }
 
         if (styleIndex == 5 && (role == 2 || role == 3)) {
@@ -1061,9 +981,9 @@ struct UniRhythm : Module {
             if (role == 1) { patterns.patterns[role*2] = amenBreakEngine.generateKick(length, density); patterns.patterns[role*2+1] = amenBreakEngine.generateKick(length, density*0.7f); }
             else if (role == 2) { patterns.patterns[role*2] = amenBreakEngine.generateSnare(length, density); patterns.patterns[role*2+1] = amenBreakEngine.generateSnare(length, density*0.6f); }
             else if (role == 3) { patterns.patterns[role*2] = amenBreakEngine.generateRandomChop(length, density, variation); patterns.patterns[role*2+1] = amenBreakEngine.generateHihat(length, density*0.8f); }
-            else { patterns.patterns[role*2+1] = patternGen.generateWithInterlock(roleType, style, length, density*0.5f, variation+0.2f, patterns.patterns[role*2]); }
+            else { patterns.patterns[role*2+1] = patternGen.generateWithInterlockCached(roleType, styleIndex, length, density*0.5f, variation+0.2f, patterns.patterns[role*2], patternSeed); }
         } else {
-            patterns.patterns[role*2+1] = patternGen.generateWithInterlock(roleType, style, length, density*0.5f, variation+0.2f, patterns.patterns[role*2]);
+            patterns.patterns[role*2+1] = patternGen.generateWithInterlockCached(roleType, styleIndex, length, density*0.5f, variation+0.2f, patterns.patterns[role*2], patternSeed);
         }
 
         if ((styleIndex == 0 || styleIndex == 1 || styleIndex == 2) && role == 2) {
@@ -1115,13 +1035,13 @@ struct UniRhythm : Module {
         originalPatterns.patterns[role*2] = patterns.patterns[role*2];
         originalPatterns.patterns[role*2+1] = patterns.patterns[role*2+1];
 
-        if (restAmount > 0.01f) {
-            restEngine.setStyle(styleIndex);
-            restEngine.applyRest(patterns.patterns[role*2], roleType, restAmount);
-            restEngine.applyRest(patterns.patterns[role*2+1], roleType, restAmount);
-        }
+        restEngine.setStyle(styleIndex);
+        restRanks[role*2] = restEngine.rankRest(originalPatterns.patterns[role*2], roleType);
+        restRanks[role*2+1] = restEngine.rankRest(originalPatterns.patterns[role*2+1], roleType);
+        applyRestToVoice(role*2, restAmount);
+        applyRestToVoice(role*2+1, restAmount);
 
-        const unirhythm::URExtendedStylePreset& preset = unirhythm::UR_EXTENDED_PRESETS[styleIndex];
+        const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
         int vb = role * 2;
         cachedFreqs[vb] = preset.voices[vb].freq; cachedFreqs[vb+1] = preset.voices[vb+1].freq;
         cachedDecays[vb] = preset.voices[vb].decay; cachedDecays[vb+1] = preset.voices[vb+1].decay;
@@ -1134,23 +1054,25 @@ struct UniRhythm : Module {
 
     void regenerateAllPatterns() { regenerateAllPatternsInterlocked(); }
 
+    // Rebuild only the voices whose rest mask moved, so REST can follow CV at audio rate
     void reapplyRest(float restAmount) {
-        for (int role = 0; role < 4; role++) {
-            int bParam = role * 5;
-            int styleIndex = static_cast<int>(params[TIMELINE_STYLE_PARAM + bParam].getValue());
-            styleIndex = clamp(styleIndex, 0, WorldRhythm::NUM_STYLES - 1);
-            WorldRhythm::Role roleType = static_cast<WorldRhythm::Role>(role);
-            patterns.patterns[role*2] = originalPatterns.patterns[role*2];
-            patterns.patterns[role*2+1] = originalPatterns.patterns[role*2+1];
-            if (restAmount > 0.01f) {
-                restEngine.setStyle(styleIndex);
-                restEngine.applyRest(patterns.patterns[role*2], roleType, restAmount);
-                restEngine.applyRest(patterns.patterns[role*2+1], roleType, restAmount);
-            }
+        for (int v = 0; v < 8; v++) {
+            if (restMaskFor(v, restAmount) != appliedRestMasks[v]) applyRestToVoice(v, restAmount);
         }
         appliedRest = restAmount;
     }
 
+    uint32_t restMaskFor(int voice, float restAmount) const {
+        return restAmount > 0.01f ? restRanks[voice].restMask(restAmount) : 0u;
+    }
+
+    void applyRestToVoice(int voice, float restAmount) {
+        uint32_t rests = restMaskFor(voice, restAmount);
+        patterns.patterns[voice] = originalPatterns.patterns[voice];
+        WorldRhythm::RestEngine::clearRests(patterns.patterns[voice], rests);
+        appliedRestMasks[voice] = rests;
+    }
+
     void triggerWithArticulation(int voice, float velocity, bool accent, float sr,
                                   int role = -1, bool isStrongBeat = false) {
         float articulationAmount = getArticulationAmount();
@@ -1218,13 +1140,14 @@ struct UniRhythm : Module {
                 if (note.isAccent && accent) accentPulses[voice].trigger(0.001f);
             } else {
                 float delayFromFirst = timingSeconds - hit.notes[0].timing;
-                DelayedTrigger dt;
-                dt.samplesRemaining = static_cast<int>(sr * delayFromFirst);
-                dt.voice = voice; dt.velocity = note.velocity;
-                dt.isAccent = note.isAccent && accent;
-                dt.role = role; dt.isStrongBeat = false; dt.isSubNote = true;
-                if (dt.samplesRemaining > 0) {
-                    if (delayedTriggerCount < MAX_DELAYED_TRIGGERS) delayedTriggers[delayedTriggerCount++] = dt;
+                int delaySamples = static_cast<int>(sr * delayFromFirst);
+                if (delaySamples > 0) {
+                    DelayedTrigger dt;
+                    dt.due = dueAfter(delaySamples);
+                    dt.voice = voice; dt.velocity = note.velocity; dt.vcaDecayMs = vcaDecayMs;
+                    dt.isAccent = note.isAccent && accent;
+                    dt.role = role; dt.isStrongBeat = false; dt.isSubNote = true;
+                    delayedTriggers.push(dt);
                 } else if (i > 0) {
                     drumSynth.triggerVoice(voice, note.velocity);
                     gatePulses[role].trigger(0.001f);
@@ -1306,28 +1229,22 @@ struct UniRhythm : Module {
             initialized = true;
         }
 
-        // Process delayed triggers (swap-and-pop)
-        for (int i = 0; i < delayedTriggerCount; ) {
-            delayedTriggers[i].samplesRemaining -= 1.0f;
-            if (delayedTriggers[i].samplesRemaining <= 0) {
-                int bParam = delayedTriggers[i].role * 5;
-                float dm = params[TIMELINE_DECAY_PARAM + bParam].getValue();
-                if (inputs[TIMELINE_DECAY_CV_INPUT + delayedTriggers[i].role * 4].isConnected()) { dm += inputs[TIMELINE_DECAY_CV_INPUT + delayedTriggers[i].role * 4].getVoltage() * 0.18f; dm = clamp(dm, 0.2f, 2.0f); }
-                float vcaDMs = 200.0f * dm;
-
-                if (!delayedTriggers[i].isSubNote) {
-                    triggerWithArticulation(delayedTriggers[i].voice, delayedTriggers[i].velocity, delayedTriggers[i].isAccent, args.sampleRate, delayedTriggers[i].role, delayedTriggers[i].isStrongBeat);
-                    externalVCA[delayedTriggers[i].voice].trigger(vcaDMs, args.sampleRate, delayedTriggers[i].velocity);
-                } else {
-                    drumSynth.triggerVoice(delayedTriggers[i].voice, delayedTriggers[i].velocity);
-                    gatePulses[delayedTriggers[i].role].trigger(0.001f);
-                    currentVelocities[delayedTriggers[i].voice] = delayedTriggers[i].velocity;
-                    currentAccents[delayedTriggers[i].voice] = delayedTriggers[i].isAccent;
-                    externalVCA[delayedTriggers[i].voice].trigger(vcaDMs, args.sampleRate, delayedTriggers[i].velocity);
-                    if (delayedTriggers[i].isAccent) accentPulses[delayedTriggers[i].voice].trigger(0.001f);
-                }
-                delayedTriggers[i] = delayedTriggers[--delayedTriggerCount];
-            } else { ++i; }
+        // Process delayed triggers: one compare unless something is due
+        sampleClock++;
+        while (delayedTriggers.nextDue() <= sampleClock) {
+            const DelayedTrigger dt = delayedTriggers.top();
+            delayedTriggers.pop();
+            if (!dt.isSubNote) {
+                triggerWithArticulation(dt.voice, dt.velocity, dt.isAccent, args.sampleRate, dt.role, dt.isStrongBeat);
+                externalVCA[dt.voice].trigger(dt.vcaDecayMs, args.sampleRate, dt.velocity);
+            } else {
+                drumSynth.triggerVoice(dt.voice, dt.velocity);
+                gatePulses[dt.role].trigger(0.001f);
+                currentVelocities[dt.voice] = dt.velocity;
+                currentAccents[dt.voice] = dt.isAccent;
+                externalVCA[dt.voice].trigger(dt.vcaDecayMs, args.sampleRate, dt.velocity);
+                if (dt.isAccent) accentPulses[dt.voice].trigger(0.001f);
+            }
         }
 
         float variation = params[VARIATION_PARAM].getValue();
@@ -1344,6 +1261,7 @@ struct UniRhythm : Module {
 
         if (regenerateTrigger.process(inputs[REGENERATE_INPUT].getVoltage()) || regenerateButtonTrigger.process(params[REGENERATE_PARAM].getValue()))
             globalRegenNeeded = true;
+        if (globalRegenNeeded) patternSeed++;
 
         if (synthUpdateNeeded && !globalRegenNeeded) applySynthModifiers();
 
@@ -1365,7 +1283,7 @@ struct UniRhythm : Module {
         }
 
         if (globalRegenNeeded) { lastVariation = variation; appliedRest = restAmount; }
-        if (std::abs(restAmount - appliedRest) > 0.03f) reapplyRest(restAmount);
+        if (restAmount != appliedRest) reapplyRest(restAmount);
 
         if (resetTrigger.process(inputs[RESET_INPUT].getVoltage()) || resetButtonTrigger.process(params[RESET_BUTTON_PARAM].getValue()))
             resetSteps();
@@ -1424,7 +1342,7 @@ struct UniRhythm : Module {
                         if (vel < 0.0f) vel = 0.0f; if (vel > 1.0f) vel = 1.0f;
                         bool acc = pp.accents[useStep % pp.length];
                         if (totalDelaySamples > 1.0f) {
-                            if (delayedTriggerCount < MAX_DELAYED_TRIGGERS) { DelayedTrigger& dt = delayedTriggers[delayedTriggerCount++]; dt.samplesRemaining = totalDelaySamples; dt.voice = vb; dt.velocity = vel; dt.isAccent = acc; dt.role = r; dt.isStrongBeat = isStrongBeat; dt.isSubNote = false; }
+                            DelayedTrigger dt; dt.due = dueAfter(totalDelaySamples); dt.voice = vb; dt.velocity = vel; dt.vcaDecayMs = 200.0f * dm; dt.isAccent = acc; dt.role = r; dt.isStrongBeat = isStrongBeat; dt.isSubNote = false; delayedTriggers.push(dt);
                         } else { triggerWithArticulation(vb, vel, acc, args.sampleRate, r, isStrongBeat); externalVCA[vb].trigger(200.0f * dm, args.sampleRate, vel); }
                     }
 
@@ -1434,7 +1352,7 @@ struct UniRhythm : Module {
                         if (vel < 0.0f) vel = 0.0f; if (vel > 1.0f) vel = 1.0f;
                         bool acc = sp.accents[useStep % sp.length];
                         if (totalDelaySamples > 1.0f) {
-                            if (delayedTriggerCount < MAX_DELAYED_TRIGGERS) { DelayedTrigger& dt = delayedTriggers[delayedTriggerCount++]; dt.samplesRemaining = totalDelaySamples; dt.voice = vb+1; dt.velocity = vel; dt.isAccent = acc; dt.role = r; dt.isStrongBeat = isStrongBeat; dt.isSubNote = false; }
+                            DelayedTrigger dt; dt.due = dueAfter(totalDelaySamples); dt.voice = vb+1; dt.velocity = vel; dt.vcaDecayMs = 200.0f * dm; dt.isAccent = acc; dt.role = r; dt.isStrongBeat = isStrongBeat; dt.isSubNote = false; delayedTriggers.push(dt);
                         } else { triggerWithArticulation(vb+1, vel, acc, args.sampleRate, r, isStrongBeat); externalVCA[vb+1].trigger(200.0f * dm, args.sampleRate, vel); }
                     }
 
@@ -1489,8 +1407,8 @@ struct UniRhythm : Module {
         isolator.process(mixL, mixR, params[ISO_LOW_PARAM].getValue(), params[ISO_MID_PARAM].getValue(), params[ISO_HIGH_PARAM].getValue());
         tubeDrive.process(mixL, mixR, params[DRIVE_PARAM].getValue());
 
-        outputs[MIX_L_OUTPUT].setVoltage(std::tanh(mixL) * 5.0f);
-        outputs[MIX_R_OUTPUT].setVoltage(std::tanh(mixR) * 5.0f);
+        outputs[MIX_L_OUTPUT].setVoltage(fastmath::tanh(mixL) * 5.0f);
+        outputs[MIX_R_OUTPUT].setVoltage(fastmath::tanh(mixR) * 5.0f);
 
         bool clockGate = clockPulse.process(args.sampleTime);
         lights[CLOCK_LIGHT].setBrightness(clockGate ? 1.0f : 0.0f);
@@ -1508,6 +1426,7 @@ struct UniRhythm : Module {
         json_t* rootJ = json_object();
         json_object_set_new(rootJ, "currentBar", json_integer(currentBar));
         json_object_set_new(rootJ, "ppqn", json_integer(ppqn));
+        json_object_set_new(rootJ, "driveOversampling", json_integer(tubeDrive.getOversamplingIndex()));
         return rootJ;
     }
 
@@ -1516,6 +1435,8 @@ struct UniRhythm : Module {
         if (barJ) currentBar = json_integer_value(barJ);
         json_t* ppqnJ = json_object_get(rootJ, "ppqn");
         if (ppqnJ) ppqn = json_integer_value(ppqnJ);
+        json_t* driveOversamplingJ = json_object_get(rootJ, "driveOversampling");
+        if (driveOversamplingJ) tubeDrive.setOversamplingIndex(json_integer_value(driveOversamplingJ));
     }
 };
 
@@ -1622,6 +1543,18 @@ struct UniRhythmWidget : ModuleWidget {
             addParam(createParamCentered<RoundSmallBlackKnob>(Vec(gX, isoKnobY), module, isoParams[i]));
         }
     }
+
+    void appendContextMenu(Menu* menu) override {
+        UniRhythm* module = dynamic_cast<UniRhythm*>(this->module);
+        if (!module) return;
+
+        menu->addChild(new MenuSeparator());
+        menu->addChild(createIndexSubmenuItem("Drive oversampling",
+            {"Off", "x2", "x4"},
+            [=]() { return module->tubeDrive.getOversamplingIndex(); },
+            [=](int mode) { module->tubeDrive.setOversamplingIndex(mode); }
+        ));
+    }
 };
 
 Model* modelUniRhythm = createModel<UniRhythm, UniRhythmWidget>("UniRhythm");
@@ -12,6 +12,7 @@
 #include "WorldRhythm/CrossRhythmEngine.hpp"
 #include "WorldRhythm/AsymmetricGroupingEngine.hpp"
 #include "WorldRhythm/AmenBreakEngine.hpp"
+#include "WorldRhythm/EventScheduler.hpp"
 // ============================================================================
 // Universal Rhythm Module - 40HP
 // Cross-cultural rhythm generator with integrated synthesis
@@ -108,136 +109,11 @@ public:
     }
 };
 
-// 8-voice style presets
-struct ExtendedStylePreset {
-    struct VoicePreset {
-        SynthMode mode;
-        float freq;
-        float decay;
-        const char* name;
-    };
-    VoicePreset voices[8];
-};
-
-// Voice assignments per style (2 voices per role):
-// 0-1: Timeline, 2-3: Foundation, 4-5: Groove, 6-7: Lead
-
-const ExtendedStylePreset EXTENDED_PRESETS[10] = {
-    // 0: West African
-    // Timeline: Bell 3-6kHz, Foundation: 80-150Hz, Groove: 250-400Hz, Lead: high
-    {{{SynthMode::SINE, 4500.0f, 60.0f, "Gankogui"},
-      {SynthMode::SINE, 3500.0f, 40.0f, "Bell Lo"},
-      {SynthMode::SINE, 80.0f, 200.0f, "Dununba"},
-      {SynthMode::SINE, 120.0f, 150.0f, "Dunun"},
-      {SynthMode::SINE, 250.0f, 80.0f, "Sangban"},
-      {SynthMode::SINE, 300.0f, 60.0f, "Kenkeni"},
-      {SynthMode::NOISE, 700.0f, 40.0f, "Djembe Slap"},
-      {SynthMode::NOISE, 400.0f, 50.0f, "Djembe Tone"}}},
-
-    // 1: Afro-Cuban
-    // Timeline: Clave 3-6kHz, Foundation: 80-150Hz, Groove: 250-700Hz, Lead: high
-    {{{SynthMode::SINE, 4000.0f, 20.0f, "Clave"},
-      {SynthMode::SINE, 2000.0f, 30.0f, "Cowbell"},
-      {SynthMode::SINE, 100.0f, 150.0f, "Tumba"},
-      {SynthMode::SINE, 150.0f, 120.0f, "Conga Lo"},
-      {SynthMode::SINE, 350.0f, 70.0f, "Conga Mid"},
-      {SynthMode::SINE, 550.0f, 50.0f, "Quinto"},
-      {SynthMode::NOISE, 3000.0f, 40.0f, "Timbales"},
-      {SynthMode::NOISE, 5000.0f, 25.0f, "Quinto Slap"}}},
-
-    // 2: Brazilian
-    // Timeline: Agogô 3-6kHz, Foundation: Surdo 55-80Hz, Groove: 250-700Hz, Lead: high
-    {{{SynthMode::SINE, 4500.0f, 35.0f, "Agogo Hi"},
-      {SynthMode::SINE, 3000.0f, 35.0f, "Agogo Lo"},
-      {SynthMode::SINE, 55.0f, 250.0f, "Surdo"},
-      {SynthMode::SINE, 80.0f, 180.0f, "Surdo 2"},
-      {SynthMode::SINE, 400.0f, 40.0f, "Tamborim"},
-      {SynthMode::NOISE, 500.0f, 50.0f, "Caixa"},
-      {SynthMode::NOISE, 6000.0f, 30.0f, "Ganza"},
-      {SynthMode::NOISE, 8000.0f, 20.0f, "Chocalho"}}},
-
-    // 3: Balkan
-    // Timeline: Rim 3-6kHz, Foundation: Tapan 90-130Hz, Groove: 250-700Hz, Lead: high
-    {{{SynthMode::NOISE, 4000.0f, 25.0f, "Rim"},
-      {SynthMode::NOISE, 3500.0f, 15.0f, "Click"},
-      {SynthMode::SINE, 90.0f, 180.0f, "Tapan Bass"},
-      {SynthMode::SINE, 130.0f, 120.0f, "Tapan Mid"},
-      {SynthMode::SINE, 300.0f, 50.0f, "Tarabuka Doum"},
-      {SynthMode::SINE, 450.0f, 35.0f, "Tarabuka Tek"},
-      {SynthMode::NOISE, 3000.0f, 25.0f, "Tek Hi"},
-      {SynthMode::NOISE, 5000.0f, 20.0f, "Ka"}}},
-
-    // 4: Indian
-    // Timeline: Manjira 6-12kHz (Air layer), Foundation: Bayan 80-150Hz, Groove: Dayan 250-700Hz
-    {{{SynthMode::NOISE, 8000.0f, 150.0f, "Manjira"},
-      {SynthMode::NOISE, 6000.0f, 100.0f, "Ghungroo"},
-      {SynthMode::SINE, 65.0f, 300.0f, "Baya Ge"},
-      {SynthMode::SINE, 90.0f, 200.0f, "Baya Ka"},
-      {SynthMode::SINE, 350.0f, 100.0f, "Daya Na"},
-      {SynthMode::SINE, 500.0f, 80.0f, "Daya Tin"},
-      {SynthMode::NOISE, 1500.0f, 60.0f, "Daya Ti"},
-      {SynthMode::NOISE, 2500.0f, 40.0f, "Daya Re"}}},
-
-    // 5: Gamelan
-    {{{SynthMode::SINE, 700.0f, 400.0f, "Kenong"},
-      {SynthMode::SINE, 600.0f, 350.0f, "Kethuk"},
-      {SynthMode::SINE, 90.0f, 800.0f, "Gong"},
-      {SynthMode::SINE, 150.0f, 500.0f, "Kempul"},
-      {SynthMode::SINE, 800.0f, 200.0f, "Bonang Po"},
-      {SynthMode::SINE, 1000.0f, 180.0f, "Bonang Sa"},
-      {SynthMode::SINE, 1200.0f, 250.0f, "Gender"},
-      {SynthMode::SINE, 1400.0f, 220.0f, "Saron"}}},
-
-    // 6: Jazz
-    // Timeline: Ride 3-6kHz (swing pattern), Foundation: Kick 40-80Hz, Groove: Snare 400-700Hz
-    {{{SynthMode::NOISE, 4500.0f, 120.0f, "Ride"},
-      {SynthMode::NOISE, 2500.0f, 80.0f, "Ride Bell"},
-      {SynthMode::SINE, 50.0f, 200.0f, "Kick"},
-      {SynthMode::SINE, 80.0f, 150.0f, "Kick Ghost"},
-      {SynthMode::NOISE, 500.0f, 100.0f, "Snare"},
-      {SynthMode::NOISE, 400.0f, 60.0f, "Snare Ghost"},
-      {SynthMode::NOISE, 8000.0f, 35.0f, "HiHat Cl"},
-      {SynthMode::NOISE, 6000.0f, 150.0f, "HiHat Op"}}},
-
-    // 7: Electronic
-    // Timeline: Hi-hat 6-12kHz, Foundation: 808 Kick 40-80Hz, Groove: Clap 1-3kHz, Lead: variable
-    {{{SynthMode::NOISE, 9000.0f, 30.0f, "HiHat"},
-      {SynthMode::NOISE, 12000.0f, 20.0f, "HiHat Ac"},
-      {SynthMode::SINE, 45.0f, 280.0f, "808 Kick"},
-      {SynthMode::SINE, 60.0f, 200.0f, "Kick 2"},
-      {SynthMode::NOISE, 1500.0f, 70.0f, "Clap"},
-      {SynthMode::NOISE, 2500.0f, 50.0f, "Snare"},
-      {SynthMode::NOISE, 6000.0f, 150.0f, "Open HH"},
-      {SynthMode::SINE, 800.0f, 100.0f, "Perc"}}},
-
-    // 8: Breakbeat
-    // Timeline: Hi-hat 6-12kHz, Foundation: Kick 40-80Hz (2-step), Groove: Snare 1-3kHz, Lead: breaks
-    {{{SynthMode::NOISE, 8000.0f, 25.0f, "HiHat"},
-      {SynthMode::NOISE, 10000.0f, 15.0f, "HiHat Ac"},
-      {SynthMode::SINE, 55.0f, 180.0f, "Kick"},
-      {SynthMode::SINE, 70.0f, 120.0f, "Kick Gho"},
-      {SynthMode::NOISE, 2500.0f, 80.0f, "Snare"},
-      {SynthMode::NOISE, 2000.0f, 50.0f, "Snare Gh"},
-      {SynthMode::NOISE, 4000.0f, 40.0f, "Ghost"},
-      {SynthMode::NOISE, 6000.0f, 100.0f, "Open HH"}}},
-
-    // 9: Techno
-    // Timeline: Hi-hat 6-12kHz, Foundation: 909 Kick 40-60Hz, Groove: Clap 1-3kHz, Lead: minimal perc
-    {{{SynthMode::NOISE, 10000.0f, 20.0f, "HiHat"},
-      {SynthMode::NOISE, 12000.0f, 12.0f, "HiHat Ac"},
-      {SynthMode::SINE, 42.0f, 250.0f, "909 Kick"},
-      {SynthMode::SINE, 55.0f, 180.0f, "Kick Lay"},
-      {SynthMode::NOISE, 1800.0f, 55.0f, "Clap"},
-      {SynthMode::NOISE, 3000.0f, 35.0f, "Rim"},
-      {SynthMode::NOISE, 5000.0f, 80.0f, "Open HH"},
-      {SynthMode::SINE, 600.0f, 60.0f, "Tom"}}}
-};
-
 // Apply preset for specific role (2 voices)
 inline void applyRolePreset(ExtendedDrumSynth& synth, int role, int styleIndex) {
     if (styleIndex < 0 || styleIndex > 9) return;
     if (role < 0 || role > 3) return;
-    const ExtendedStylePreset& preset = EXTENDED_PRESETS[styleIndex];
+    const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
     int voiceBase = role * 2;
     synth.setVoiceParams(voiceBase, preset.voices[voiceBase].mode,
                          preset.voices[voiceBase].freq, preset.voices[voiceBase].decay);
@@ -430,6 +306,9 @@ struct UniversalRhythm : Module {
     int currentSteps[4] = {0, 0, 0, 0};     // Per-role step counters
     int currentBar = 0;
     float appliedRest = 0.0f;              // Last applied rest amount
+    WorldRhythm::RestRanks restRanks[8];   // Per-voice rest order, ranked at generation
+    uint32_t appliedRestMasks[8] = {};     // Steps currently silenced by rest
+    uint32_t patternSeed = 0;              // Advanced by REGENERATE/VARIATION, keys the pattern cache
 
     // Cached synth parameters for TUNE/DECAY modification
     float cachedFreqs[8] = {0};
@@ -471,19 +350,25 @@ struct UniversalRhythm : Module {
     int ppqn = 4;
     int ppqnCounter = 0;  // Counter for clock division
 
-    // Flam/Drag delayed trigger support
+    // Flam/Drag delayed trigger support, due on an absolute sample clock
     static constexpr int MAX_DELAYED_TRIGGERS = 64;
     struct DelayedTrigger {
-        float samplesRemaining = 0;
+        uint64_t due = 0;       // sampleClock value at which it fires
         int voice = -1;
         float velocity = 0;
+        float vcaDecayMs = 200.0f;  // VCA decay captured when scheduled
         bool isAccent = false;
         int role = 0;           // Role index for articulation profile
         bool isStrongBeat = false;  // For articulation selection
         bool isSubNote = false;     // True for articulation sub-notes (no further articulation needed)
     };
-    DelayedTrigger delayedTriggers[MAX_DELAYED_TRIGGERS];
-    int delayedTriggerCount = 0;
+    WorldRhythm::EventScheduler<DelayedTrigger, MAX_DELAYED_TRIGGERS> delayedTriggers;
+    uint64_t sampleClock = 0;  // process() calls so far
+
+    // Delays count from the next process() call, rounded up to whole samples
+    uint64_t dueAfter(float delaySamples) const {
+        return sampleClock + static_cast<uint64_t>(std::ceil(delaySamples));
+    }
 
     // Change detection (per role)
     int lastStyles[4] = {-1, -1, -1, -1};
@@ -691,7 +576,7 @@ struct UniversalRhythm : Module {
                     currentFreqs[voiceIdx] = newFreq;  // Store for Pitch CV output
                     int styleIndex = lastStyles[role];
                     if (styleIndex >= 0 && styleIndex <= 9) {
-                        const worldrhythm::ExtendedStylePreset& preset = worldrhythm::EXTENDED_PRESETS[styleIndex];
+                        const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
                         drumSynth.setVoiceParams(voiceIdx, preset.voices[voiceIdx].mode, newFreq, newDecay);
                     }
                 }
@@ -877,15 +762,15 @@ struct UniversalRhythm : Module {
             originalPatterns.patterns[r * 2] = patterns.patterns[r * 2];
             originalPatterns.patterns[r * 2 + 1] = patterns.patterns[r * 2 + 1];
 
-            // Apply RestEngine (position-weighted rest)
-            if (restAmount > 0.01f) {
-                restEngine.setStyle(styleIndex);
-                restEngine.applyRest(patterns.patterns[r * 2], roleType, restAmount);
-                restEngine.applyRest(patterns.patterns[r * 2 + 1], roleType, restAmount);
-            }
+            // Rank once for on-the-fly rest, then apply the current amount
+            restEngine.setStyle(styleIndex);
+            restRanks[r * 2] = restEngine.rankRest(originalPatterns.patterns[r * 2], roleType);
+            restRanks[r * 2 + 1] = restEngine.rankRest(originalPatterns.patterns[r * 2 + 1], roleType);
+            applyRestToVoice(r * 2, restAmount);
+            applyRestToVoice(r * 2 + 1, restAmount);
 
             // Apply and cache synth preset for this role
-            const worldrhythm::ExtendedStylePreset& preset = worldrhythm::EXTENDED_PRESETS[styleIndex];
+            const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
             int voiceBase = r * 2;
             cachedFreqs[voiceBase] = preset.voices[voiceBase].freq;
             cachedFreqs[voiceBase + 1] = preset.voices[voiceBase + 1].freq;
@@ -932,7 +817,7 @@ struct UniversalRhythm : Module {
             lastDensities[role] = density;
             lastLengths[role] = length;
             // Cache synth preset
-            const worldrhythm::ExtendedStylePreset& preset = worldrhythm::EXTENDED_PRESETS[styleIndex];
+            const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
             int voiceBase = role * 2;
             cachedFreqs[voiceBase] = preset.voices[voiceBase].freq;
             cachedFreqs[voiceBase + 1] = preset.voices[voiceBase + 1].freq;
@@ -958,36 +843,36 @@ struct UniversalRhythm : Module {
 
         // Generate with interlock against other roles if available
         if (role == WorldRhythm::TIMELINE) {
-            patterns.patterns[role * 2] = patternGen.generate(roleType, style, length, density, variation);
+            patterns.patterns[role * 2] = patternGen.generateCached(roleType, styleIndex, length, density, variation, patternSeed);
         } else if (role == WorldRhythm::FOUNDATION) {
             // Foundation avoids Timeline
             WorldRhythm::PatternGenerator::InterlockConfig config =
                 WorldRhythm::PatternGenerator::getStyleInterlockConfig(styleIndex);
             if (config.avoidFoundationOnTimeline) {
-                patterns.patterns[role * 2] = patternGen.generateFoundationWithInterlock(
-                    style, length, density, variation, patterns.patterns[0], config.avoidanceStrength);
+                patterns.patterns[role * 2] = patternGen.generateFoundationWithInterlockCached(
+                    styleIndex, length, density, variation, patterns.patterns[0], patternSeed);
             } else {
-                patterns.patterns[role * 2] = patternGen.generateFoundation(style, length, density, variation);
+                patterns.patterns[role * 2] = patternGen.generateCached(roleType, styleIndex, length, density, variation, patternSeed);
             }
         } else if (role == WorldRhythm::GROOVE) {
             // Groove complements Foundation
             WorldRhythm::PatternGenerator::InterlockConfig config =
                 WorldRhythm::PatternGenerator::getStyleInterlockConfig(styleIndex);
             if (config.grooveComplementsFoundation) {
-                patterns.patterns[role * 2] = patternGen.generateGrooveWithComplement(
-                    style, length, density, variation, patterns.patterns[2], patterns.patterns[0], config);
+                patterns.patterns[role * 2] = patternGen.generateGrooveWithComplementCached(
+                    styleIndex, length, density, variation, patterns.patterns[2], patterns.patterns[0], patternSeed);
             } else {
-                patterns.patterns[role * 2] = patternGen.generate(roleType, style, length, density, variation);
+                patterns.patterns[role * 2] = patternGen.generateCached(roleType, styleIndex, length, density, variation, patternSeed);
             }
         } else {
             // Lead - optional groove avoidance
             WorldRhythm::PatternGenerator::InterlockConfig config =
                 WorldRhythm::PatternGenerator::getStyleInterlockConfig(styleIndex);
             if (config.leadAvoidsGroove) {
-                patterns.patterns[role * 2] = patternGen.generateWithInterlock(
-                    roleType, style, length, density * 0.6f, variation, patterns.patterns[4]);
+                patterns.patterns[role * 2] = patternGen.generateWithInterlockCached(
+                    roleType, styleIndex, length, density * 0.6f, variation, patterns.patterns[4], patternSeed);
             } else {
-                patterns.patterns[role * 2] = patternGen.generate(roleType, style, length, density * 0.6f, variation);
+                patterns.patterns[role * 2] = patternGen.generateCached(roleType, styleIndex, length, density * 0.6f, variation, patternSeed);
             }
         }
 
@@ -1018,15 +903,15 @@ struct UniversalRhythm : Module {
                 patterns.patterns[role * 2 + 1] = amenBreakEngine.generateHihat(length, density * 0.8f);
             } else {
                 // Timeline uses standard generation
-                patterns.patterns[role * 2 + 1] = patternGen.generateWithInterlock(
-                    roleType, style, length, density * 0.5f, variation + 0.2f,
-                    patterns.patterns[role * 2]);
+                patterns.patterns[role * 2 + 1] = patternGen.generateWithInterlockCached(
+                    roleType, styleIndex, length, density * 0.5f, variation + 0.2f,
+                    patterns.patterns[role * 2], patternSeed);
             }
         }
         else {
-            patterns.patterns[role * 2 + 1] = patternGen.generateWithInterlock(
-                roleType, style, length, density * 0.5f, variation + 0.2f,
-                patterns.patterns[role * 2]);
+            patterns.patterns[role * 2 + 1] = patternGen.generateWithInterlockCached(
+                roleType, styleIndex, length, density * 0.5f, variation + 0.2f,
+                patterns.patterns[role * 2], patternSeed);
         }
 
         // Apply CrossRhythmEngine for African/Cuban/Brazilian styles (0, 1, 2)
@@ -1095,15 +980,15 @@ struct UniversalRhythm : Module {
         originalPatterns.patterns[role * 2] = patterns.patterns[role * 2];
         originalPatterns.patterns[role * 2 + 1] = patterns.patterns[role * 2 + 1];
 
-        // Apply RestEngine (position-weighted rest)
-        if (restAmount > 0.01f) {
-            restEngine.setStyle(styleIndex);
-            restEngine.applyRest(patterns.patterns[role * 2], roleType, restAmount);
-            restEngine.applyRest(patterns.patterns[role * 2 + 1], roleType, restAmount);
-        }
+        // Rank once for on-the-fly rest, then apply the current amount
+        restEngine.setStyle(styleIndex);
+        restRanks[role * 2] = restEngine.rankRest(originalPatterns.patterns[role * 2], roleType);
+        restRanks[role * 2 + 1] = restEngine.rankRest(originalPatterns.patterns[role * 2 + 1], roleType);
+        applyRestToVoice(role * 2, restAmount);
+        applyRestToVoice(role * 2 + 1, restAmount);
 
         // Apply and cache synth preset for this role
-        const worldrhythm::ExtendedStylePreset& preset = worldrhythm::EXTENDED_PRESETS[styleIndex];
+        const WorldRhythm::DrumStylePreset& preset = WorldRhythm::DRUM_STYLE_PRESETS[styleIndex];
         int voiceBase = role * 2;
         cachedFreqs[voiceBase] = preset.voices[voiceBase].freq;
         cachedFreqs[voiceBase + 1] = preset.voices[voiceBase + 1].freq;
@@ -1124,28 +1009,30 @@ struct UniversalRhythm : Module {
         regenerateAllPatternsInterlocked();
     }
 
-    // Reapply rest from original patterns without regenerating rhythm
+    // Reapply rest from the precomputed ranks without regenerating rhythm.
+    // Only voices whose rest mask moved are rebuilt, so REST can follow CV
+    // at audio rate.
     void reapplyRest(float restAmount) {
-        for (int role = 0; role < 4; role++) {
-            int baseParam = role * 5;
-            int styleIndex = static_cast<int>(params[TIMELINE_STYLE_PARAM + baseParam].getValue());
-            styleIndex = clamp(styleIndex, 0, WorldRhythm::NUM_STYLES - 1);
-            WorldRhythm::Role roleType = static_cast<WorldRhythm::Role>(role);
-
-            // Copy from original patterns
-            patterns.patterns[role * 2] = originalPatterns.patterns[role * 2];
-            patterns.patterns[role * 2 + 1] = originalPatterns.patterns[role * 2 + 1];
-
-            // Apply rest if needed
-            if (restAmount > 0.01f) {
-                restEngine.setStyle(styleIndex);
-                restEngine.applyRest(patterns.patterns[role * 2], roleType, restAmount);
-                restEngine.applyRest(patterns.patterns[role * 2 + 1], roleType, restAmount);
+        for (int v = 0; v < 8; v++) {
+            if (restMaskFor(v, restAmount) != appliedRestMasks[v]) {
+                applyRestToVoice(v, restAmount);
             }
         }
         appliedRest = restAmount;
     }
 
+    uint32_t restMaskFor(int voice, float restAmount) const {
+        return restAmount > 0.01f ? restRanks[voice].restMask(restAmount) : 0u;
+    }
+
+    // Working pattern = original with the ranked steps silenced
+    void applyRestToVoice(int voice, float restAmount) {
+        uint32_t rests = restMaskFor(voice, restAmount);
+        patterns.patterns[voice] = originalPatterns.patterns[voice];
+        WorldRhythm::RestEngine::clearRests(patterns.patterns[voice], rests);
+        appliedRestMasks[voice] = rests;
+    }
+
     // Trigger voice with articulation type applied
     // Uses ArticulationProfiles to select articulation based on style, role, and amount
     void triggerWithArticulation(int voice, float velocity, bool accent, float sampleRate,
@@ -1265,18 +1152,18 @@ struct UniversalRhythm : Module {
                 // Schedule as delayed trigger
                 // For negative timing, we need to offset from the first note
                 float delayFromFirst = timingSeconds - hit.notes[0].timing;
-                DelayedTrigger dt;
-                dt.samplesRemaining = static_cast<int>(sampleRate * delayFromFirst);
-                dt.voice = voice;
-                dt.velocity = note.velocity;
-                dt.isAccent = note.isAccent && accent;
-                dt.role = role;  // Pass role for VCA triggering
-                dt.isStrongBeat = false;
-                dt.isSubNote = true;  // Mark as sub-note (no further articulation needed)
-                if (dt.samplesRemaining > 0) {
-                    if (delayedTriggerCount < MAX_DELAYED_TRIGGERS) {
-                        delayedTriggers[delayedTriggerCount++] = dt;
-                    }
+                int delaySamples = static_cast<int>(sampleRate * delayFromFirst);
+                if (delaySamples > 0) {
+                    DelayedTrigger dt;
+                    dt.due = dueAfter(delaySamples);
+                    dt.voice = voice;
+                    dt.velocity = note.velocity;
+                    dt.vcaDecayMs = vcaDecayMs;
+                    dt.isAccent = note.isAccent && accent;
+                    dt.role = role;
+                    dt.isStrongBeat = false;
+                    dt.isSubNote = true;  // Mark as sub-note (no further articulation needed)
+                    delayedTriggers.push(dt);
                 } else if (i > 0) {
                     // Immediate trigger for notes at same time as first
                     drumSynth.triggerVoice(voice, note.velocity);
@@ -1404,42 +1291,29 @@ struct UniversalRhythm : Module {
             initialized = true;
         }
 
-        // Process delayed triggers (for swing/groove timing and Flam, Drag, Buzz, Ruff articulations)
-        for (int i = 0; i < delayedTriggerCount; ) {
-            delayedTriggers[i].samplesRemaining -= 1.0f;
-            if (delayedTriggers[i].samplesRemaining <= 0) {
-                // Calculate VCA decay for this role
-                int baseParam = delayedTriggers[i].role * 5;
-                float decayMult = params[TIMELINE_DECAY_PARAM + baseParam].getValue();
-                if (inputs[TIMELINE_DECAY_CV_INPUT + delayedTriggers[i].role * 4].isConnected()) {
-                    decayMult += inputs[TIMELINE_DECAY_CV_INPUT + delayedTriggers[i].role * 4].getVoltage() * 0.18f;
-                    decayMult = clamp(decayMult, 0.2f, 2.0f);
-                }
-                float vcaDecayMs = 200.0f * decayMult;
+        // Process delayed triggers (for swing/groove timing and Flam, Drag, Buzz, Ruff articulations).
+        // Nothing is due most samples, so this is a single compare.
+        sampleClock++;
+        while (delayedTriggers.nextDue() <= sampleClock) {
+            const DelayedTrigger dt = delayedTriggers.top();
+            delayedTriggers.pop();
 
-                if (!delayedTriggers[i].isSubNote) {
-                    // Main trigger - apply articulation
-                    triggerWithArticulation(delayedTriggers[i].voice, delayedTriggers[i].velocity,
-                                           delayedTriggers[i].isAccent, args.sampleRate,
-                                           delayedTriggers[i].role, delayedTriggers[i].isStrongBeat);
-                    // Trigger VCA for external audio
-                    externalVCA[delayedTriggers[i].voice].trigger(vcaDecayMs, args.sampleRate, delayedTriggers[i].velocity);
-                } else {
-                    // Articulation sub-note - direct trigger (no further articulation)
-                    drumSynth.triggerVoice(delayedTriggers[i].voice, delayedTriggers[i].velocity);
-                    gatePulses[delayedTriggers[i].voice].trigger(0.001f);
-                    currentVelocities[delayedTriggers[i].voice] = delayedTriggers[i].velocity;
-                    currentAccents[delayedTriggers[i].voice] = delayedTriggers[i].isAccent;
-                    // Trigger VCA for external audio (sub-notes also trigger VCA)
-                    externalVCA[delayedTriggers[i].voice].trigger(vcaDecayMs, args.sampleRate, delayedTriggers[i].velocity);
-                    if (delayedTriggers[i].isAccent) {
-                        accentPulses[delayedTriggers[i].voice].trigger(0.001f);
-                    }
-                }
-                // Remove by swapping with last element
-                delayedTriggers[i] = delayedTriggers[--delayedTriggerCount];
+            if (!dt.isSubNote) {
+                // Main trigger - apply articulation
+                triggerWithArticulation(dt.voice, dt.velocity, dt.isAccent, args.sampleRate, dt.role, dt.isStrongBeat);
+                // Trigger VCA for external audio
+                externalVCA[dt.voice].trigger(dt.vcaDecayMs, args.sampleRate, dt.velocity);
             } else {
-                ++i;
+                // Articulation sub-note - direct trigger (no further articulation)
+                drumSynth.triggerVoice(dt.voice, dt.velocity);
+                gatePulses[dt.voice].trigger(0.001f);
+                currentVelocities[dt.voice] = dt.velocity;
+                currentAccents[dt.voice] = dt.isAccent;
+                // Trigger VCA for external audio (sub-notes also trigger VCA)
+                externalVCA[dt.voice].trigger(dt.vcaDecayMs, args.sampleRate, dt.velocity);
+                if (dt.isAccent) {
+                    accentPulses[dt.voice].trigger(0.001f);
+                }
             }
         }
 
@@ -1472,6 +1346,15 @@ struct UniversalRhythm : Module {
             globalRegenNeeded = true;
         }
 
+        // A new seed asks for new patterns. Under the same seed, moving a
+        // role's style/density/length back recalls the PatternGenerator
+        // output for both of its voices from the cache; the Kotekan/Amen,
+        // cross-rhythm, humanize, accent and ghost passes on top still draw
+        // fresh randomness
+        if (globalRegenNeeded) {
+            patternSeed++;
+        }
+
         // Update synth params without full regeneration
         if (synthUpdateNeeded && !globalRegenNeeded) {
             applySynthModifiers();
@@ -1516,8 +1399,8 @@ struct UniversalRhythm : Module {
             appliedRest = restAmount;
         }
 
-        // Check if REST amount changed significantly (reapply without regen)
-        if (std::abs(restAmount - appliedRest) > 0.03f) {
+        // REST moved (reapply without regen, a threshold per voice)
+        if (restAmount != appliedRest) {
             reapplyRest(restAmount);
         }
 
@@ -1648,16 +1531,16 @@ struct UniversalRhythm : Module {
 
                         if (totalDelaySamples > 1.0f) {
                             // Positive delay: use delayed trigger
-                            if (delayedTriggerCount < MAX_DELAYED_TRIGGERS) {
-                                DelayedTrigger& dt = delayedTriggers[delayedTriggerCount++];
-                                dt.samplesRemaining = totalDelaySamples;
-                                dt.voice = voiceBase;
-                                dt.velocity = vel;
-                                dt.isAccent = accent;
-                                dt.role = r;
-                                dt.isStrongBeat = isStrongBeat;
-                                dt.isSubNote = false;
-                            }
+                            DelayedTrigger dt;
+                            dt.due = dueAfter(totalDelaySamples);
+                            dt.voice = voiceBase;
+                            dt.velocity = vel;
+                            dt.vcaDecayMs = 200.0f * decayMult;
+                            dt.isAccent = accent;
+                            dt.role = r;
+                            dt.isStrongBeat = isStrongBeat;
+                            dt.isSubNote = false;
+                            delayedTriggers.push(dt);
                         } else {
                             // Zero or negative delay: trigger immediately
                             // (negative means "ahead of beat" - we trigger now, which is effectively early)
@@ -1678,16 +1561,16 @@ struct UniversalRhythm : Module {
                         vel = std::clamp(vel, 0.0f, 1.0f);
                         bool accent = secondaryPattern.accents[useStep];
                         if (totalDelaySamples > 1.0f) {
-                            if (delayedTriggerCount < MAX_DELAYED_TRIGGERS) {
-                                DelayedTrigger& dt = delayedTriggers[delayedTriggerCount++];
-                                dt.samplesRemaining = totalDelaySamples;
-                                dt.voice = voiceBase + 1;
-                                dt.velocity = vel;
-                                dt.isAccent = accent;
-                                dt.role = r;
-                                dt.isStrongBeat = isStrongBeat;
-                                dt.isSubNote = false;
-                            }
+                            DelayedTrigger dt;
+                            dt.due = dueAfter(totalDelaySamples);
+                            dt.voice = voiceBase + 1;
+                            dt.velocity = vel;
+                            dt.vcaDecayMs = 200.0f * decayMult;
+                            dt.isAccent = accent;
+                            dt.role = r;
+                            dt.isStrongBeat = isStrongBeat;
+                            dt.isSubNote = false;
+                            delayedTriggers.push(dt);
                         } else {
                             triggerWithArticulation(voiceBase + 1, vel, accent, args.sampleRate, r, isStrongBeat);
                             // Trigger VCA for external audio (use decay parameter for envelope length)
@@ -1,4 +1,6 @@
 #include "plugin.hpp"
+#include "SmootherBank.hpp"
+#include "SampleStore.hpp"
 #include <cmath>
 #include <ctime>
 #include <cstring>
@@ -12,9 +14,16 @@ static constexpr int MAX_SLICES = 64;
 static constexpr int MAX_VOICES = 8;
 static constexpr int MAX_MORPHERS = 20;
 
+// Layer audio storage: 16-bit over the +-12 V rail, half the memory of
+// float at 0.4 mV resolution, well below the slice thresholds
+using LayerBuffer = sampling::Int16Store<MAX_BUFFER_SIZE>;
+
 struct AudioLayer {
-    float bufferL[MAX_BUFFER_SIZE];
-    float bufferR[MAX_BUFFER_SIZE];
+    LayerBuffer bufferL;
+    LayerBuffer bufferR;
+    // Single-voice playback reads through its own decoded block
+    sampling::BlockReader<LayerBuffer> readerL;
+    sampling::BlockReader<LayerBuffer> readerR;
     int playbackPosition = 0;
     float playbackPhase = 0.0f;
     int recordedLength = 0;
@@ -31,10 +40,8 @@ struct AudioLayer {
     }
 
     void clear() {
-        for (int i = 0; i < MAX_BUFFER_SIZE; i++) {
-            bufferL[i] = 0.0f;
-            bufferR[i] = 0.0f;
-        }
+        bufferL.clear();
+        bufferR.clear();
         playbackPosition = 0;
         playbackPhase = 0.0f;
         recordedLength = 0;
@@ -305,33 +312,14 @@ struct WeiiiDocumenta : Module {
     float sampleHoldCV = 0.0f;         // S&H CV輸出（±10V with AMT）
 
     // ===== Parameter smoothing to prevent zipper noise =====
-    struct SmoothedParam {
-        float value = 0.f;
-        float target = 0.f;
-
-        void setTarget(float newTarget) {
-            target = newTarget;
-        }
-
-        float process() {
-            // Exponential smoothing with ~5ms time constant at 44.1kHz
-            const float alpha = 0.995f;
-            value = value * alpha + target * (1.f - alpha);
-            return value;
-        }
-
-        void reset(float initValue) {
-            value = initValue;
-            target = initValue;
-        }
+    enum SmoothedIds {
+        SMOOTH_SCAN,
+        SMOOTH_THRESHOLD,
+        SMOOTH_LOOP_END,
+        SMOOTH_FEEDBACK_AMOUNT,
+        NUM_SMOOTHED
     };
-
-    // Smoothed parameters for all knobs
-    SmoothedParam smoothedScan;
-    SmoothedParam smoothedThreshold;
-    SmoothedParam smoothedLoopEnd;
-    SmoothedParam smoothedFeedbackAmount;
-    SmoothedParam smoothedFeedbackDelay;
+    smoothing::SmootherBank<NUM_SMOOTHED> smoothers;
 
     // ===== Polyphonic Voice System =====
     // Slice crossfade: 0.1ms fade in/out to prevent clicks (max freq ~5kHz)
@@ -348,6 +336,8 @@ struct WeiiiDocumenta : Module {
         bool fadingOut = false;       // Currently fading out
         int pendingSliceIndex = -1;   // Slice to switch to after fade out
         int pendingPlaybackPosition = 0; // Position to start at after fade out
+        sampling::BlockReader<LayerBuffer> readerL;  // 每個 voice 各自快取解碼區塊
+        sampling::BlockReader<LayerBuffer> readerR;
     };
 
     Voice voices[MAX_VOICES];         // 固定陣列取代 vector
@@ -446,16 +436,15 @@ struct WeiiiDocumenta : Module {
         // morphers 已是固定陣列，無需 resize
 
         // 初始化 smoothed parameters
-        smoothedScan.reset(0.0f);
-        smoothedThreshold.reset(1.0f);
-        smoothedLoopEnd.reset(1.0f);
-        smoothedFeedbackAmount.reset(0.0f);
-        smoothedFeedbackDelay.reset(0.5f);
+        smoothers.reset(SMOOTH_SCAN, 0.0f);
+        smoothers.reset(SMOOTH_THRESHOLD, 1.0f);
+        smoothers.reset(SMOOTH_LOOP_END, 1.0f);
+        smoothers.reset(SMOOTH_FEEDBACK_AMOUNT, 0.0f);
     }
 
-    // 處理單一樣本（在 oversample 速率下執行）
+    // 處理單一樣本（每個原始樣本一次，oversampling 已移除）
     std::pair<float, float> processSingleSample(float inputL, float inputR, float sampleRate, float sampleTime) {
-        // 播放和混音（在 oversample 速率下執行）
+        // 播放和混音（在原始速率執行）
         float outputL = 0.0f;
         float outputR = 0.0f;
 
@@ -496,8 +485,8 @@ struct WeiiiDocumenta : Module {
                 float frac = floatPos - (int)floatPos;
 
                 // 線性插值
-                outputL = layer.bufferL[pos0] * (1.0f - frac) + layer.bufferL[pos1] * frac;
-                outputR = layer.bufferR[pos0] * (1.0f - frac) + layer.bufferR[pos1] * frac;
+                outputL = layer.readerL.read(layer.bufferL, pos0) * (1.0f - frac) + layer.readerL.read(layer.bufferL, pos1) * frac;
+                outputR = layer.readerR.read(layer.bufferR, pos0) * (1.0f - frac) + layer.readerR.read(layer.bufferR, pos1) * frac;
 
                 // Apply fade envelope
                 outputL *= layer.fadeEnvelope;
@@ -533,8 +522,9 @@ struct WeiiiDocumenta : Module {
                     float frac = floatPos - (int)floatPos;
 
                     // 線性插值 with fade envelope
-                    float voiceL = (layer.bufferL[pos0] * (1.0f - frac) + layer.bufferL[pos1] * frac) * voices[i].fadeEnvelope;
-                    float voiceR = (layer.bufferR[pos0] * (1.0f - frac) + layer.bufferR[pos1] * frac) * voices[i].fadeEnvelope;
+                    Voice& voice = voices[i];
+                    float voiceL = (voice.readerL.read(layer.bufferL, pos0) * (1.0f - frac) + voice.readerL.read(layer.bufferL, pos1) * frac) * voice.fadeEnvelope;
+                    float voiceR = (voice.readerR.read(layer.bufferR, pos0) * (1.0f - frac) + voice.readerR.read(layer.bufferR, pos1) * frac) * voice.fadeEnvelope;
 
                     // Per-voice equal-power auto panning (preserve stereo width)
                     float pan = (numVoices == 1) ? 0.0f : -1.0f + 2.0f * (float)i / (float)(numVoices - 1);
@@ -551,7 +541,7 @@ struct WeiiiDocumenta : Module {
         }
 
         // ===== No-Input Feedback 回饋處理 =====
-        float feedbackAmount = smoothedFeedbackAmount.process();
+        float feedbackAmount = smoothers.get(SMOOTH_FEEDBACK_AMOUNT);
         if (feedbackAmount > 0.0f) {
             // Analog-style soft saturation with tanh
             // Scale factor 0.3 keeps small signals linear while saturating large ones
@@ -567,7 +557,7 @@ struct WeiiiDocumenta : Module {
 
     void process(const ProcessArgs& args) override {
         // ===== 更新 smoothed parameter 目標值 =====
-        smoothedScan.setTarget(params[SCAN_PARAM].getValue());
+        smoothers.setTarget(SMOOTH_SCAN, params[SCAN_PARAM].getValue());
 
         // Threshold with CV
         float thresholdValue = params[THRESHOLD_PARAM].getValue();
@@ -575,9 +565,9 @@ struct WeiiiDocumenta : Module {
             float thresholdCv = inputs[THRESHOLD_CV_INPUT].getVoltage();
             thresholdValue = clamp(thresholdValue + thresholdCv, 0.0f, 10.0f);
         }
-        smoothedThreshold.setTarget(thresholdValue);
+        smoothers.setTarget(SMOOTH_THRESHOLD, thresholdValue);
 
-        smoothedLoopEnd.setTarget(params[LOOP_END_PARAM].getValue());
+        smoothers.setTarget(SMOOTH_LOOP_END, params[LOOP_END_PARAM].getValue());
 
         // Feedback Amount with CV
         float feedbackValue = params[FEEDBACK_AMOUNT_PARAM].getValue();
@@ -586,7 +576,12 @@ struct WeiiiDocumenta : Module {
             float feedbackAtten = params[FEEDBACK_AMOUNT_CV_ATTEN_PARAM].getValue();
             feedbackValue = clamp(feedbackValue + feedbackCv * feedbackAtten, 0.0f, 1.0f);
         }
-        smoothedFeedbackAmount.setTarget(feedbackValue);
+        smoothers.setTarget(SMOOTH_FEEDBACK_AMOUNT, feedbackValue);
+        // One step per engine sample for every smoother. processSingleSample
+        // also runs once per sample, so the feedback amount glides with the
+        // same time constant it had when it was stepped there.
+        smoothers.setSampleRate(args.sampleRate);
+        smoothers.process();
 
         // 處理按鈕觸發（在每個原始樣本執行一次）
         float recTriggerSignal = params[REC_BUTTON_PARAM].getValue();
@@ -599,9 +594,11 @@ struct WeiiiDocumenta : Module {
                 recordPosition = 0;
                 numSlices = 0;  // 重置切片
                 lastAmplitude = 0.0f;
-                lastThreshold = smoothedThreshold.value;  // 記錄當前 threshold
+                lastThreshold = smoothers.get(SMOOTH_THRESHOLD);  // 記錄當前 threshold
             } else {
                 // 錄音停止：記錄實際長度並結束最後一個切片
+                layer.bufferL.flush();
+                layer.bufferR.flush();
                 layer.recordedLength = recordPosition;
                 if (numSlices > 0 && slices[numSlices - 1].active) {
                     slices[numSlices - 1].endSample = recordPosition;
@@ -716,7 +713,7 @@ struct WeiiiDocumenta : Module {
 
         // ===== 自動偵測 threshold 或 min slice time 變化並重新掃描切片 =====
         // 先 process threshold 以保持值更新（無論是否錄音）
-        float currentThreshold = smoothedThreshold.process();
+        float currentThreshold = smoothers.get(SMOOTH_THRESHOLD);
         float currentMinSliceTime = params[THRESHOLD_CV_ATTEN_PARAM].getValue();
 
         // 不在錄音時才進行重新掃描
@@ -760,14 +757,14 @@ struct WeiiiDocumenta : Module {
         // 錄音（在原始速率執行，不進行 oversample）
         if (isRecording) {
             if (recordPosition < MAX_BUFFER_SIZE) {
-                layer.bufferL[recordPosition] = inputL;
-                layer.bufferR[recordPosition] = inputR;
+                layer.bufferL.write(recordPosition, inputL);
+                layer.bufferR.write(recordPosition, inputR);
 
                 // 即時更新錄音長度
                 layer.recordedLength = recordPosition + 1;
 
                 // 切片檢測：偵測音量突變 使用混合訊號
-                float threshold = smoothedThreshold.value;
+                float threshold = smoothers.get(SMOOTH_THRESHOLD);
                 float mixedSample = (inputL + inputR) * 0.5f;
                 float currentAmp = std::abs(mixedSample);
 
@@ -805,7 +802,7 @@ struct WeiiiDocumenta : Module {
 
         // 播放位置推進（每個原始樣本一次）
         if (isPlaying || isLooping) {
-            float scanValue = smoothedScan.process();
+            float scanValue = smoothers.get(SMOOTH_SCAN);
 
             // 處理 SCAN CV 輸入
             if (inputs[SCAN_CV_INPUT].isConnected()) {
@@ -824,7 +821,7 @@ struct WeiiiDocumenta : Module {
                 scanValue = clamp(scanValue + shForScan, 0.0f, 1.0f);
             }
 
-            float loopEnd = smoothedLoopEnd.process();
+            float loopEnd = smoothers.get(SMOOTH_LOOP_END);
 
             if (layer.active && layer.recordedLength > 0) {
                 // 計算 loop 結束點
@@ -1466,14 +1463,15 @@ struct WeiiiDocumenta : Module {
         numSlices = 0;
 
         // 使用當前 threshold 重新掃描整個 buffer
-        float threshold = smoothedThreshold.value;
+        float threshold = smoothers.get(SMOOTH_THRESHOLD);
         float minSliceTime = params[THRESHOLD_CV_ATTEN_PARAM].getValue(); // 最小切片時間（秒）
         int minSliceSamples = (int)(minSliceTime * 48000.0f); // 假設 48kHz
         float lastAmp = 0.0f;
+        sampling::BlockReader<LayerBuffer> readerL, readerR;
 
         for (int pos = 0; pos < layer.recordedLength; pos++) {
             // 使用混合訊號
-            float mixedSample = (layer.bufferL[pos] + layer.bufferR[pos]) * 0.5f;
+            float mixedSample = (readerL.read(layer.bufferL, pos) + readerR.read(layer.bufferR, pos)) * 0.5f;
             float currentAmp = std::abs(mixedSample);
 
             // 偵測從低音量到高音量的突變（attack）
@@ -1552,19 +1550,22 @@ json_object_set_new(rootJ, "morphAmount", json_real(morphAmount));
             json_object_set_new(rootJ, "recordPosition", json_integer(recordPosition));
 
             // Save buffer data using base64 encoding
-            // Convert float arrays to bytes for efficient storage
+            // Patches keep float32 samples whatever the in-RAM storage is
             size_t bufferBytes = layer.recordedLength * sizeof(float);
+            std::vector<float> samples(layer.recordedLength);
 
             // Left channel
+            layer.bufferL.readBlock(0, layer.recordedLength, samples.data());
             std::string base64L = rack::string::toBase64(
-                (const uint8_t*)layer.bufferL,
+                (const uint8_t*)samples.data(),
                 bufferBytes
             );
             json_object_set_new(rootJ, "bufferL", json_string(base64L.c_str()));
 
             // Right channel
+            layer.bufferR.readBlock(0, layer.recordedLength, samples.data());
             std::string base64R = rack::string::toBase64(
-                (const uint8_t*)layer.bufferR,
+                (const uint8_t*)samples.data(),
                 bufferBytes
             );
             json_object_set_new(rootJ, "bufferR", json_string(base64R.c_str()));
@@ -1666,9 +1667,16 @@ json_t* morphAmountJ = json_object_get(rootJ, "morphAmount");
                     size_t expectedBytes = savedLength * sizeof(float);
 
                     if (bytesL.size() == expectedBytes && bytesR.size() == expectedBytes) {
-                        // Copy decoded bytes back to float arrays
-                        std::memcpy(layer.bufferL, bytesL.data(), expectedBytes);
-                        std::memcpy(layer.bufferR, bytesR.data(), expectedBytes);
+                        // Decode bytes back to floats and store them
+                        for (int i = 0; i < savedLength; i++) {
+                            float sampleL, sampleR;
+                            std::memcpy(&sampleL, &bytesL[i * sizeof(float)], sizeof(float));
+                            std::memcpy(&sampleR, &bytesR[i * sizeof(float)], sizeof(float));
+                            layer.bufferL.write(i, sampleL);
+                            layer.bufferR.write(i, sampleR);
+                        }
+                        layer.bufferL.flush();
+                        layer.bufferR.flush();
                     }
                 }
 
@@ -1749,9 +1757,10 @@ json_t* morphAmountJ = json_object_get(rootJ, "morphAmount");
         std::fwrite(&dataSize, 4, 1, file);
 
         // Write audio data (interleaved stereo, 16-bit PCM)
+        sampling::BlockReader<LayerBuffer> readerL, readerR;
         for (int i = 0; i < maxLength; i++) {
-            float mixL = layer.bufferL[i];
-            float mixR = layer.bufferR[i];
+            float mixL = readerL.read(layer.bufferL, i);
+            float mixR = readerR.read(layer.bufferR, i);
 
             // Clamp and convert to 16-bit PCM (從 ±10V 縮放到 ±1.0)
             int16_t sampleL = (int16_t)clamp((mixL / 10.0f) * 32767.0f, -32768.0f, 32767.0f);
@@ -1876,10 +1885,12 @@ json_t* morphAmountJ = json_object_get(rootJ, "morphAmount");
                 continue;
             }
 
-            layer.bufferL[i] = sampleL;
-            layer.bufferR[i] = sampleR;
+            layer.bufferL.write(i, sampleL);
+            layer.bufferR.write(i, sampleR);
         }
 
+        layer.bufferL.flush();
+        layer.bufferR.flush();
         layer.recordedLength = framesToCopy;
         layer.playbackPosition = 0;
         layer.active = true;  // 確保 layer 啟用
@@ -1896,8 +1907,9 @@ json_t* morphAmountJ = json_object_get(rootJ, "morphAmount");
         numSlices = 1;
 
         // 掃描找出峰值振幅
+        sampling::BlockReader<LayerBuffer> readerL, readerR;
         for (int i = 0; i < framesToCopy; i++) {
-            float amp = std::max(std::abs(layer.bufferL[i]), std::abs(layer.bufferR[i]));
+            float amp = std::max(std::abs(readerL.read(layer.bufferL, i)), std::abs(readerR.read(layer.bufferR, i)));
             if (amp > slices[0].peakAmplitude) {
                 slices[0].peakAmplitude = amp;
             }
@@ -1905,12 +1917,12 @@ json_t* morphAmountJ = json_object_get(rootJ, "morphAmount");
 
         // 重設 loop end 到最大
         params[LOOP_END_PARAM].setValue(1.0f);
-        smoothedLoopEnd.reset(1.0f);
+        smoothers.reset(SMOOTH_LOOP_END, 1.0f);
 
         // 重設可能造成雜音的參數
         params[SPEED_PARAM].setValue(0.5f);  // 正常1x速度 (旋鈕中間位置)
         params[FEEDBACK_AMOUNT_PARAM].setValue(0.0f);
-        smoothedFeedbackAmount.reset(0.0f);
+        smoothers.reset(SMOOTH_FEEDBACK_AMOUNT, 0.0f);
 
         // 開始播放
         isPlaying = true;
@@ -377,10 +377,7 @@ public:
             float extraDensity = (density - 0.4f) / 0.6f;  // 0.4->0, 1.0->1.0
             // Target: at density 1.0, aim for ~50% of positions (8 hits in 16 steps)
             int targetTotal = static_cast<int>(std::round(length * density * 0.5f));
-            int currentHits = 0;
-            for (int i = 0; i < length; i++) {
-                if (p.hasOnsetAt(i)) currentHits++;
-            }
+            int currentHits = p.countOnsets();
             int extraHits = std::max(0, targetTotal - currentHits);
 
             for (int n = 0; n < extraHits; n++) {
@@ -452,10 +449,7 @@ public:
             float extraDensity = (density - 0.4f) / 0.6f;
             // Target: at density 1.0, aim for ~45% of positions
             int targetTotal = static_cast<int>(std::round(length * density * 0.45f));
-            int currentHits = 0;
-            for (int i = 0; i < length; i++) {
-                if (p.hasOnsetAt(i)) currentHits++;
-            }
+            int currentHits = p.countOnsets();
             int extraHits = std::max(0, targetTotal - currentHits);
 
             for (int n = 0; n < extraHits; n++) {
@@ -527,10 +521,7 @@ public:
             float extraDensity = (density - 0.4f) / 0.6f;
             // Target: at density 1.0, aim for ~85% of positions (hi-hats are dense)
             int targetTotal = static_cast<int>(std::round(length * density * 0.85f));
-            int currentHits = 0;
-            for (int i = 0; i < length; i++) {
-                if (p.hasOnsetAt(i)) currentHits++;
-            }
+            int currentHits = p.countOnsets();
             int extraHits = std::max(0, targetTotal - currentHits);
 
             for (int n = 0; n < extraHits; n++) {
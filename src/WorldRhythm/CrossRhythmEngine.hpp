@@ -384,11 +384,11 @@ public:
         int baseSteps = layer.denominator;
         float baseInterval = static_cast<float>(length) / baseSteps;
 
-        std::vector<int> basePositions;
+        uint32_t baseMask = 0;
         for (int i = 0; i < baseSteps; i++) {
             int step = static_cast<int>(i * baseInterval);
             if (step >= length) step = length - 1;
-            basePositions.push_back(step);
+            baseMask |= 1u << step;
 
             float vel = (i == 0) ? 0.95f : 0.75f;
             result.baseLayer.setOnset(step, std::clamp(vel * intensity + velVar(rng), 0.5f, 1.0f));
@@ -398,17 +398,16 @@ public:
         // Cross layer: numerator 網格
         auto crossHits = calculatePreciseCrossRhythm(type, length);
 
+        // Base 位置及其左右鄰步（±1 步內視為衝突）
+        uint32_t nearBase = baseMask | (baseMask << 1) | (baseMask >> 1);
+
         for (const auto& hit : crossHits) {
             // 檢查是否與 base layer 衝突
-            bool collision = false;
-            for (int basePos : basePositions) {
-                if (std::abs(hit.step - basePos) <= 1) {
-                    collision = true;
-                    if (hit.step == basePos) {
-                        result.syncPoints.push_back(hit.step);
-                    }
-                    break;
-                }
+            bool collision = (nearBase >> hit.step) & 1u;
+            // 同步點：最靠前的相鄰 base 正好落在同一步
+            bool leftNeighbor = hit.step > 0 && ((baseMask >> (hit.step - 1)) & 1u);
+            if (collision && ((baseMask >> hit.step) & 1u) && !leftNeighbor) {
+                result.syncPoints.push_back(hit.step);
             }
 
             if (!collision || allowSync) {
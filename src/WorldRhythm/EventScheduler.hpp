@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+
+namespace WorldRhythm {
+
+// ========================================
+// Event Scheduler
+// ========================================
+// Fixed-capacity min-heap of events keyed on an absolute sample clock.
+// The audio loop only compares the clock against the earliest deadline;
+// pushing and popping are O(log n) and never allocate. Events due on the
+// same sample come out in the order they were scheduled.
+//
+// Event must have a `uint64_t due` member.
+
+template <typename Event, int CAPACITY>
+class EventScheduler {
+public:
+    static constexpr uint64_t NEVER = UINT64_MAX;
+
+    bool empty() const { return count == 0; }
+    int size() const { return count; }
+    void clear() { count = 0; }
+
+    // Deadline of the earliest event, NEVER when empty
+    uint64_t nextDue() const { return count > 0 ? heap[0].event.due : NEVER; }
+
+    const Event& top() const { return heap[0].event; }
+
+    // Returns false (and drops the event) when full
+    bool push(const Event& event) {
+        if (count >= CAPACITY) return false;
+        int i = count++;
+        Entry entry{event, nextSequence++};
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (!earlier(entry, heap[parent])) break;
+            heap[i] = heap[parent];
+            i = parent;
+        }
+        heap[i] = entry;
+        return true;
+    }
+
+    void pop() {
+        if (count == 0) return;
+        Entry last = heap[--count];
+        int i = 0;
+        while (true) {
+            int child = 2 * i + 1;
+            if (child >= count) break;
+            if (child + 1 < count && earlier(heap[child + 1], heap[child])) child++;
+            if (!earlier(heap[child], last)) break;
+            heap[i] = heap[child];
+            i = child;
+        }
+        heap[i] = last;
+    }
+
+private:
+    struct Entry {
+        Event event;
+        uint32_t sequence;  // tie-break for equal deadlines
+    };
+
+    static bool earlier(const Entry& a, const Entry& b) {
+        if (a.event.due != b.event.due) return a.event.due < b.event.due;
+        return (int32_t)(a.sequence - b.sequence) < 0;
+    }
+
+    Entry heap[CAPACITY];
+    int count = 0;
+    uint32_t nextSequence = 0;
+};
+
+} // namespace WorldRhythm
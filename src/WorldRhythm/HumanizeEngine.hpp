@@ -76,121 +76,6 @@ struct NoteInfo {
     bool hasError;          // Is this a "mistake"
 };
 
-// ========================================
-// Groove Template
-// ========================================
-// Each position has a systematic timing offset that defines the "feel"
-struct GrooveTemplate {
-    std::string name;
-    float offsets[16];      // Timing offsets in ms for each 16th note position
-    float velMods[16];      // Velocity modifiers (multiplier)
-};
-
-// ========================================
-// Style-Specific Groove Templates
-// ========================================
-inline GrooveTemplate createSwingGroove() {
-    GrooveTemplate g;
-    g.name = "Swing";
-    // Swing: upbeats pushed late
-    g.offsets[0] = 0.0f;   g.velMods[0] = 1.0f;
-    g.offsets[1] = 8.0f;   g.velMods[1] = 0.85f;   // Late
-    g.offsets[2] = 0.0f;   g.velMods[2] = 0.9f;
-    g.offsets[3] = 10.0f;  g.velMods[3] = 0.8f;    // Late
-    g.offsets[4] = 0.0f;   g.velMods[4] = 0.95f;
-    g.offsets[5] = 7.0f;   g.velMods[5] = 0.85f;
-    g.offsets[6] = 0.0f;   g.velMods[6] = 0.9f;
-    g.offsets[7] = 9.0f;   g.velMods[7] = 0.8f;
-    g.offsets[8] = -2.0f;  g.velMods[8] = 1.0f;    // Beat 3 slightly early
-    g.offsets[9] = 8.0f;   g.velMods[9] = 0.85f;
-    g.offsets[10] = 0.0f;  g.velMods[10] = 0.9f;
-    g.offsets[11] = 10.0f; g.velMods[11] = 0.8f;
-    g.offsets[12] = 0.0f;  g.velMods[12] = 0.95f;
-    g.offsets[13] = 7.0f;  g.velMods[13] = 0.85f;
-    g.offsets[14] = 0.0f;  g.velMods[14] = 0.9f;
-    g.offsets[15] = 9.0f;  g.velMods[15] = 0.8f;
-    return g;
-}
-
-inline GrooveTemplate createAfricanGroove() {
-    GrooveTemplate g;
-    g.name = "African";
-    // West African: specific positions pushed/pulled for polyrhythmic feel
-    g.offsets[0] = 0.0f;   g.velMods[0] = 1.0f;
-    g.offsets[1] = -3.0f;  g.velMods[1] = 0.7f;    // Early
-    g.offsets[2] = 2.0f;   g.velMods[2] = 0.85f;
-    g.offsets[3] = -2.0f;  g.velMods[3] = 0.9f;    // Bell pattern
-    g.offsets[4] = 0.0f;   g.velMods[4] = 0.8f;
-    g.offsets[5] = 3.0f;   g.velMods[5] = 0.75f;
-    g.offsets[6] = -1.0f;  g.velMods[6] = 0.95f;   // Strong
-    g.offsets[7] = 2.0f;   g.velMods[7] = 0.7f;
-    g.offsets[8] = 0.0f;   g.velMods[8] = 0.85f;
-    g.offsets[9] = -3.0f;  g.velMods[9] = 0.7f;
-    g.offsets[10] = 1.0f;  g.velMods[10] = 0.9f;   // Bell
-    g.offsets[11] = 0.0f;  g.velMods[11] = 0.75f;
-    g.offsets[12] = 2.0f;  g.velMods[12] = 1.0f;   // Strong
-    g.offsets[13] = -2.0f; g.velMods[13] = 0.7f;
-    g.offsets[14] = 0.0f;  g.velMods[14] = 0.8f;
-    g.offsets[15] = 3.0f;  g.velMods[15] = 0.75f;
-    return g;
-}
-
-inline GrooveTemplate createLatinGroove() {
-    GrooveTemplate g;
-    g.name = "Latin";
-    // Afro-Cuban: clave-based feel
-    g.offsets[0] = 0.0f;   g.velMods[0] = 1.0f;    // Clave
-    g.offsets[1] = 4.0f;   g.velMods[1] = 0.7f;
-    g.offsets[2] = 0.0f;   g.velMods[2] = 0.8f;
-    g.offsets[3] = -2.0f;  g.velMods[3] = 0.95f;   // Clave
-    g.offsets[4] = 0.0f;   g.velMods[4] = 0.75f;
-    g.offsets[5] = 5.0f;   g.velMods[5] = 0.7f;
-    g.offsets[6] = -1.0f;  g.velMods[6] = 0.9f;    // Clave
-    g.offsets[7] = 3.0f;   g.velMods[7] = 0.7f;
-    g.offsets[8] = 0.0f;   g.velMods[8] = 0.8f;
-    g.offsets[9] = 4.0f;   g.velMods[9] = 0.7f;
-    g.offsets[10] = -2.0f; g.velMods[10] = 0.95f;  // Clave
-    g.offsets[11] = 3.0f;  g.velMods[11] = 0.7f;
-    g.offsets[12] = 0.0f;  g.velMods[12] = 0.9f;   // Clave
-    g.offsets[13] = 5.0f;  g.velMods[13] = 0.7f;
-    g.offsets[14] = 0.0f;  g.velMods[14] = 0.75f;
-    g.offsets[15] = 4.0f;  g.velMods[15] = 0.7f;
-    return g;
-}
-
-inline GrooveTemplate createStraightGroove() {
-    GrooveTemplate g;
-    g.name = "Straight";
-    // Machine-like but with subtle humanization
-    for (int i = 0; i < 16; i++) {
-        g.offsets[i] = 0.0f;
-        g.velMods[i] = (i % 4 == 0) ? 1.0f : ((i % 2 == 0) ? 0.9f : 0.8f);
-    }
-    return g;
-}
-
-inline GrooveTemplate createLaidBackGroove() {
-    GrooveTemplate g;
-    g.name = "Laid Back";
-    // Everything slightly behind the beat
-    for (int i = 0; i < 16; i++) {
-        g.offsets[i] = 4.0f + (i % 2) * 2.0f;
-        g.velMods[i] = (i % 4 == 0) ? 1.0f : 0.85f;
-    }
-    return g;
-}
-
-inline GrooveTemplate createPushedGroove() {
-    GrooveTemplate g;
-    g.name = "Pushed";
-    // Everything slightly ahead
-    for (int i = 0; i < 16; i++) {
-        g.offsets[i] = -3.0f - (i % 2) * 1.5f;
-        g.velMods[i] = (i % 4 == 0) ? 1.0f : 0.9f;
-    }
-    return g;
-}
-
 // ========================================
 // Style-Specific Timing Variance (v0.16, v0.20 academic update)
 // ========================================
@@ -393,8 +278,7 @@ private:
     // v0.18.6: 使用 mutable 允許 const 成員函數修改 rng 狀態
     mutable std::mt19937 rng;
 
-    // Groove templates by style
-    std::vector<GrooveTemplate> grooveTemplates;
+    // Groove template by style, index into GROOVE_TEMPLATES
     int currentGrooveIndex = 0;
 
     // Style-specific timing (v0.16)
@@ -425,13 +309,6 @@ private:
 
 public:
     HumanizeEngine() : rng(12345) {
-        grooveTemplates.push_back(createStraightGroove());
-        grooveTemplates.push_back(createSwingGroove());
-        grooveTemplates.push_back(createAfricanGroove());
-        grooveTemplates.push_back(createLatinGroove());
-        grooveTemplates.push_back(createLaidBackGroove());
-        grooveTemplates.push_back(createPushedGroove());
-
         // Initialize timing profile
         currentTimingProfile = getStyleTimingProfile(0);
     }
@@ -611,7 +488,7 @@ public:
 
     // 獲取帶有 BPM 感知的完整 microtiming
     float getSwingAwareMicrotiming(int step, Role role, float amount, float bpm) const {
-        const GrooveTemplate& groove = grooveTemplates[currentGrooveIndex];
+        const GrooveTemplate& groove = GROOVE_TEMPLATES[currentGrooveIndex];
         int pos = step % 16;
 
         // 基礎 groove 偏移
@@ -680,7 +557,7 @@ public:
     // Groove Template Management
     // ========================================
     void setGrooveTemplate(int index) {
-        if (index >= 0 && index < static_cast<int>(grooveTemplates.size())) {
+        if (index >= 0 && index < NUM_GROOVE_TEMPLATES) {
             currentGrooveIndex = index;
         }
     }
@@ -702,14 +579,14 @@ public:
     }
 
     const GrooveTemplate& getCurrentGroove() const {
-        return grooveTemplates[currentGrooveIndex];
+        return GROOVE_TEMPLATES[currentGrooveIndex];
     }
 
     // ========================================
     // Microtiming with Groove Template (v0.16 enhanced, v0.19 unified swing)
     // ========================================
     float getGrooveMicrotiming(int step, Role role, float amount) const {
-        const GrooveTemplate& groove = grooveTemplates[currentGrooveIndex];
+        const GrooveTemplate& groove = GROOVE_TEMPLATES[currentGrooveIndex];
         int pos = step % 16;
 
         // Base offset from groove template
@@ -944,7 +821,7 @@ public:
         }
 
         // Base velocity with groove template modifier
-        const GrooveTemplate& groove = grooveTemplates[currentGrooveIndex];
+        const GrooveTemplate& groove = GROOVE_TEMPLATES[currentGrooveIndex];
         int pos = step % 16;
         note.velocity = velocity * groove.velMods[pos];
 
@@ -1269,12 +1146,12 @@ public:
     }
 
     int getNumGrooveTemplates() const {
-        return static_cast<int>(grooveTemplates.size());
+        return NUM_GROOVE_TEMPLATES;
     }
 
     const char* getGrooveTemplateName(int index) const {
-        if (index >= 0 && index < static_cast<int>(grooveTemplates.size())) {
-            return grooveTemplates[index].name.c_str();
+        if (index >= 0 && index < NUM_GROOVE_TEMPLATES) {
+            return GROOVE_TEMPLATES[index].name;
         }
         return "Unknown";
     }
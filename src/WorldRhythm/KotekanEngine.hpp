@@ -577,11 +577,7 @@ public:
     // Calculate Combined Density
     // ========================================
     float getCombinedDensity(const KotekanPair& pair) const {
-        int onsets = 0;
-        for (int i = 0; i < pair.combined.length; i++) {
-            if (pair.combined.hasOnsetAt(i)) onsets++;
-        }
-        return static_cast<float>(onsets) / pair.combined.length;
+        return PatternBits(pair.combined).density();
     }
 
     // ========================================
@@ -610,25 +606,17 @@ public:
         result.conflictCount = 0;
         result.gapCount = 0;
 
-        int polosCount = 0;
-        int sangsihCount = 0;
         int totalSteps = pair.combined.length;
 
-        for (int i = 0; i < totalSteps; i++) {
-            bool hasPolos = pair.polos.hasOnsetAt(i) && pair.polos.getVelocity(i) > 0.3f;
-            bool hasSangsih = pair.sangsih.hasOnsetAt(i) && pair.sangsih.getVelocity(i) > 0.3f;
-
-            if (hasPolos) polosCount++;
-            if (hasSangsih) sangsihCount++;
+        // 只計強音（velocity > 0.3）
+        uint32_t polos = pair.polos.onsetMask(0.3f);
+        uint32_t sangsih = pair.sangsih.onsetMask(0.3f);
+        int polosCount = popcount(polos);
+        int sangsihCount = popcount(sangsih);
 
-            if (hasPolos && hasSangsih) {
-                // 兩者同時有強音 = 衝突
-                result.conflictCount++;
-            } else if (!hasPolos && !hasSangsih) {
-                // 都沒有 = 空白
-                result.gapCount++;
-            }
-        }
+        // 兩者同時有強音 = 衝突；都沒有 = 空白
+        result.conflictCount = popcount(polos & sangsih);
+        result.gapCount = popcount(~(polos | sangsih) & PatternBits::fullMask(totalSteps));
 
         // 計算分數
         result.complementarity = 1.0f - (static_cast<float>(result.conflictCount) / totalSteps);
@@ -678,35 +666,41 @@ public:
         KotekanPair result = input;
         std::uniform_real_distribution<float> velVar(-0.05f, 0.05f);
 
-        for (int i = 0; i < input.combined.length; i++) {
-            float polosVel = input.polos.getVelocity(i);
-            float sangsihVel = input.sangsih.getVelocity(i);
-            bool hasPolos = polosVel > 0.1f;
-            bool hasSangsih = sangsihVel > 0.1f;
+        int length = input.combined.length;
+        uint32_t full = PatternBits::fullMask(length);
+        uint32_t even = PatternBits::evenSteps(length);
+        uint32_t polos = input.polos.onsetMask(0.1f) & full;
+        uint32_t sangsih = input.sangsih.onsetMask(0.1f) & full;
+
+        // 衝突：根據位置決定保留哪個
+        // 偶數位置優先 Polos，奇數優先 Sangsih
+        uint32_t conflicts = polos & sangsih;
+        for (uint32_t m = conflicts & even; m; m &= m - 1) {
+            int i = lowestStep(m);
+            result.sangsih.clearOnset(i);
+            result.sangsih.accents[i] = false;
+        }
+        for (uint32_t m = conflicts & ~even; m; m &= m - 1) {
+            int i = lowestStep(m);
+            result.polos.clearOnset(i);
+            result.polos.accents[i] = false;
+        }
 
-            if (hasPolos && hasSangsih) {
-                // 衝突：根據位置決定保留哪個
-                // 偶數位置優先 Polos，奇數優先 Sangsih
-                if (i % 2 == 0) {
-                    result.sangsih.setOnset(i, 0.0f);
-                    result.sangsih.accents[i] = false;
-                } else {
-                    result.polos.setOnset(i, 0.0f);
-                    result.polos.accents[i] = false;
-                }
-            } else if (!hasPolos && !hasSangsih) {
-                // 空白：填充一個音
-                float fillVel = 0.6f + velVar(rng);
-                fillVel = std::clamp(fillVel, 0.4f, 0.8f);
+        // 空白：填充一個音（依步序抽亂數，結果與逐步版本相同）
+        for (uint32_t m = ~(polos | sangsih) & full; m; m &= m - 1) {
+            int i = lowestStep(m);
+            float fillVel = 0.6f + velVar(rng);
+            fillVel = std::clamp(fillVel, 0.4f, 0.8f);
 
-                if (i % 2 == 0) {
-                    result.polos.setOnset(i, fillVel);
-                } else {
-                    result.sangsih.setOnset(i, fillVel);
-                }
+            if (i % 2 == 0) {
+                result.polos.setOnset(i, fillVel);
+            } else {
+                result.sangsih.setOnset(i, fillVel);
             }
+        }
 
-            // 更新 combined
+        // 更新 combined（之後每一步都恰有一方發聲）
+        for (int i = 0; i < length; i++) {
             float finalVel = std::max(result.polos.getVelocity(i),
                                       result.sangsih.getVelocity(i));
             result.combined.setOnset(i, finalVel);
@@ -3,6 +3,8 @@
 #include <random>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include "StyleProfiles.hpp"
 
 namespace WorldRhythm {
@@ -54,19 +56,268 @@ struct Pattern {
         if (length <= 0) return;
         velocities[pos % length] = 0.0f;
     }
+
+    // Bit i set when step i has velocity above minVelocity
+    uint32_t onsetMask(float minVelocity = 0.0f) const {
+        uint32_t mask = 0;
+        for (int i = 0; i < length; i++) {
+            if (velocities[i] > minVelocity) mask |= 1u << i;
+        }
+        return mask;
+    }
+
+    uint32_t accentMask() const {
+        uint32_t mask = 0;
+        for (int i = 0; i < length; i++) {
+            if (accents[i]) mask |= 1u << i;
+        }
+        return mask;
+    }
+
+    int countOnsets() const;
+};
+
+// ========================================
+// Onset structure as bit masks
+// ========================================
+// Bit i = step i. Velocities stay in the Pattern; engines that only ask
+// which steps sound (density, interlock, collisions, rotation) work on
+// these masks with popcount and shifts instead of per-step loops.
+
+inline int popcount(uint32_t mask) {
+    return __builtin_popcount(mask);
+}
+
+// Index of the lowest set step; iterate with `for (m = mask; m; m &= m - 1)`
+inline int lowestStep(uint32_t mask) {
+    return __builtin_ctz(mask);
+}
+
+struct PatternBits {
+    uint32_t onsets = 0;
+    uint32_t accents = 0;
+    int length = 16;
+
+    PatternBits() {}
+
+    explicit PatternBits(const Pattern& p, float minVelocity = 0.0f)
+        : onsets(p.onsetMask(minVelocity)), accents(p.accentMask()), length(p.length) {}
+
+    static uint32_t fullMask(int length) {
+        return length >= 32 ? 0xFFFFFFFFu : (1u << length) - 1u;
+    }
+
+    // Steps 0, 2, 4, ... within length
+    static uint32_t evenSteps(int length) {
+        return 0x55555555u & fullMask(length);
+    }
+
+    // Cyclic rotation within length: step i moves to step i + steps
+    static uint32_t rotate(uint32_t mask, int length, int steps) {
+        steps = ((steps % length) + length) % length;
+        if (steps == 0) return mask;
+        uint32_t full = fullMask(length);
+        mask &= full;
+        return ((mask << steps) | (mask >> (length - steps))) & full;
+    }
+
+    int count() const { return popcount(onsets); }
+
+    float density() const {
+        return static_cast<float>(count()) / length;
+    }
+
+    bool has(int step) const {
+        return (onsets >> (step % length)) & 1u;
+    }
+
+    PatternBits rotated(int steps) const {
+        PatternBits r = *this;
+        r.onsets = rotate(onsets, length, steps);
+        r.accents = rotate(accents, length, steps);
+        return r;
+    }
+
+    // Rests become onsets and onsets rests; accents do not carry over
+    PatternBits complement() const {
+        PatternBits r;
+        r.length = length;
+        r.onsets = ~onsets & fullMask(length);
+        return r;
+    }
+};
+
+inline int Pattern::countOnsets() const {
+    return popcount(onsetMask());
+}
+
+// ========================================
+// Seeded pattern cache
+// ========================================
+// Performers move back and forth between the same few settings, so seeded
+// generations are kept in a fixed-size LRU table (no allocation). Every
+// fresh generation reseeds from the key, which makes a hit bit-identical
+// to generating again.
+struct PatternCacheKey {
+    enum Kind { WEIGHTED, INTERLOCK, FOUNDATION_INTERLOCK, GROOVE_COMPLEMENT };
+
+    int kind = WEIGHTED;
+    int style = 0;
+    int role = 0;
+    int length = 0;
+    int densityStep = 0;          // density quantized to PatternGenerator::DENSITY_STEPS
+    uint32_t variationBits = 0;   // exact, variation is a plain knob
+    uint32_t seed = 0;
+    // Patterns the generation avoids or complements. The generators only
+    // ask them hasOnsetAt(), so onsets and length identify them fully.
+    uint32_t referenceOnsets[2] = {0, 0};
+    int referenceLength[2] = {0, 0};
+
+    void setReference(int slot, const Pattern& p) {
+        referenceOnsets[slot] = p.onsetMask();
+        referenceLength[slot] = p.length;
+    }
+
+    bool operator==(const PatternCacheKey& o) const {
+        return kind == o.kind && style == o.style && role == o.role && length == o.length &&
+               densityStep == o.densityStep && variationBits == o.variationBits && seed == o.seed &&
+               referenceOnsets[0] == o.referenceOnsets[0] && referenceLength[0] == o.referenceLength[0] &&
+               referenceOnsets[1] == o.referenceOnsets[1] && referenceLength[1] == o.referenceLength[1];
+    }
+
+    // Seed for the fresh generation, mixes every field
+    uint32_t hash() const {
+        uint32_t h = seed * 0x9E3779B9u;
+        const uint32_t fields[10] = {(uint32_t)kind, (uint32_t)style, (uint32_t)role, (uint32_t)length,
+                                     (uint32_t)densityStep, variationBits,
+                                     referenceOnsets[0], (uint32_t)referenceLength[0],
+                                     referenceOnsets[1], (uint32_t)referenceLength[1]};
+        for (uint32_t v : fields) {
+            h = (h ^ v) * 0x85EBCA6Bu;
+            h ^= h >> 13;
+        }
+        return h;
+    }
+};
+
+template <int CAPACITY>
+struct PatternCache {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+
+    bool find(const PatternCacheKey& key, Pattern& out) {
+        for (int i = 0; i < CAPACITY; i++) {
+            if (entries[i].used && entries[i].key == key) {
+                entries[i].lastUsed = ++tick;
+                out = entries[i].pattern;
+                hits++;
+                return true;
+            }
+        }
+        misses++;
+        return false;
+    }
+
+    // Fills a free slot, otherwise replaces the least recently used one
+    void insert(const PatternCacheKey& key, const Pattern& p) {
+        int victim = 0;
+        for (int i = 0; i < CAPACITY; i++) {
+            if (!entries[i].used) {
+                victim = i;
+                break;
+            }
+            if (entries[i].lastUsed < entries[victim].lastUsed) victim = i;
+        }
+        entries[victim].key = key;
+        entries[victim].pattern = p;
+        entries[victim].lastUsed = ++tick;
+        entries[victim].used = true;
+    }
+
+    void clear() {
+        for (int i = 0; i < CAPACITY; i++) entries[i].used = false;
+        hits = 0;
+        misses = 0;
+    }
+
+private:
+    struct Entry {
+        PatternCacheKey key;
+        Pattern pattern;
+        uint32_t lastUsed = 0;
+        bool used = false;
+    };
+
+    Entry entries[CAPACITY];
+    uint32_t tick = 0;
 };
 
 class PatternGenerator {
 private:
     std::mt19937 rng;
+    std::mt19937 savedRng;  // shared stream, parked while a cached pattern is generated
+    PatternCache<32> cache;
 
 public:
+    static constexpr int DENSITY_STEPS = 100;
+
     PatternGenerator() : rng(12345) {}  // Fixed seed for MetaModule compatibility
 
     void seed(unsigned int s) {
         rng.seed(s);
     }
 
+    // ========================================
+    // Seeded generation through the cache
+    // ========================================
+    // Each *Cached call gives the same output as its uncached generator
+    // with density rounded to DENSITY_STEPS and the RNG seeded from the
+    // key. The shared RNG stream is left untouched on both hit and miss,
+    // so later calls do not depend on what was cached.
+    Pattern generateCached(Role role, int styleIndex, int length, float density,
+                           float variation, uint32_t patternSeed) {
+        PatternCacheKey key = makeKey(PatternCacheKey::WEIGHTED, role, styleIndex, length, density, variation, patternSeed);
+        return cached(key, [&](float d) {
+            return generate(role, *STYLES[key.style], key.length, d, variation);
+        });
+    }
+
+    Pattern generateWithInterlockCached(Role role, int styleIndex, int length, float density,
+                                        float variation, const Pattern& reference, uint32_t patternSeed) {
+        PatternCacheKey key = makeKey(PatternCacheKey::INTERLOCK, role, styleIndex, length, density, variation, patternSeed);
+        key.setReference(0, reference);
+        return cached(key, [&](float d) {
+            return generateWithInterlock(role, *STYLES[key.style], key.length, d, variation, reference);
+        });
+    }
+
+    // Timeline avoidance follows the style's InterlockConfig
+    Pattern generateFoundationWithInterlockCached(int styleIndex, int length, float density, float variation,
+                                                  const Pattern& timeline, uint32_t patternSeed) {
+        PatternCacheKey key = makeKey(PatternCacheKey::FOUNDATION_INTERLOCK, FOUNDATION, styleIndex, length, density, variation, patternSeed);
+        key.setReference(0, timeline);
+        return cached(key, [&](float d) {
+            return generateFoundationWithInterlock(*STYLES[key.style], key.length, d, variation, timeline,
+                                                   getStyleInterlockConfig(key.style).avoidanceStrength);
+        });
+    }
+
+    Pattern generateGrooveWithComplementCached(int styleIndex, int length, float density, float variation,
+                                               const Pattern& foundation, const Pattern& timeline,
+                                               uint32_t patternSeed) {
+        PatternCacheKey key = makeKey(PatternCacheKey::GROOVE_COMPLEMENT, GROOVE, styleIndex, length, density, variation, patternSeed);
+        key.setReference(0, foundation);
+        key.setReference(1, timeline);
+        return cached(key, [&](float d) {
+            return generateGrooveWithComplement(*STYLES[key.style], key.length, d, variation, foundation, timeline,
+                                                getStyleInterlockConfig(key.style));
+        });
+    }
+
+    uint32_t getCacheHits() const { return cache.hits; }
+    uint32_t getCacheMisses() const { return cache.misses; }
+    void clearCache() { cache.clear(); }
+
     // ========================================
     // Core: Weighted Selection
     // ========================================
@@ -647,23 +898,15 @@ public:
         }
 
         // 後處理：確保完美互補（移除任何重疊）
-        for (int i = 0; i < length; i++) {
-            if (polos.hasOnsetAt(i) && sangsih.hasOnsetAt(i)) {
-                // 重疊：偶數位置保留 Polos，奇數位置保留 Sangsih
-                if (i % 2 == 0) {
-                    sangsih.clearOnset(i);
-                } else {
-                    polos.clearOnset(i);
-                }
-            }
-        }
+        // 重疊：偶數位置保留 Polos，奇數位置保留 Sangsih
+        uint32_t overlap = polos.onsetMask() & sangsih.onsetMask();
+        uint32_t even = PatternBits::evenSteps(length);
+        for (uint32_t m = overlap & even; m; m &= m - 1) sangsih.clearOnset(lowestStep(m));
+        for (uint32_t m = overlap & ~even; m; m &= m - 1) polos.clearOnset(lowestStep(m));
 
         // 確保至少有一些音符
-        int polosCount = 0, sangsihCount = 0;
-        for (int i = 0; i < length; i++) {
-            if (polos.hasOnsetAt(i)) polosCount++;
-            if (sangsih.hasOnsetAt(i)) sangsihCount++;
-        }
+        int polosCount = polos.countOnsets();
+        int sangsihCount = sangsih.countOnsets();
 
         // 如果某個 pattern 太空，補充最少音符
         if (polosCount == 0) {
@@ -682,14 +925,7 @@ public:
         if (amount <= 0.0f) return;
 
         // Don't add ghost notes to empty patterns (respect density=0)
-        bool hasAnyOnset = false;
-        for (int i = 0; i < p.length; i++) {
-            if (p.hasOnsetAt(i)) {
-                hasAnyOnset = true;
-                break;
-            }
-        }
-        if (!hasAnyOnset) return;
+        if (p.onsetMask() == 0) return;
 
         std::uniform_real_distribution<float> dist(0.0f, 1.0f);
         std::uniform_real_distribution<float> velVar(-0.03f, 0.03f);
@@ -856,6 +1092,35 @@ public:
     }
 
 private:
+    PatternCacheKey makeKey(PatternCacheKey::Kind kind, Role role, int styleIndex, int length,
+                            float density, float variation, uint32_t patternSeed) const {
+        PatternCacheKey key;
+        key.kind = kind;
+        key.style = std::clamp(styleIndex, 0, NUM_STYLES - 1);
+        key.role = role;
+        key.length = std::max(1, std::min(length, MAX_PATTERN_LENGTH));
+        key.densityStep = static_cast<int>(std::round(std::clamp(density, 0.0f, 1.0f) * DENSITY_STEPS));
+        std::memcpy(&key.variationBits, &variation, sizeof(key.variationBits));
+        key.seed = patternSeed;
+        return key;
+    }
+
+    // Looks the key up; on a miss runs generate(quantizedDensity) on an RNG
+    // seeded from the key and stores the result
+    template <typename Generate>
+    Pattern cached(const PatternCacheKey& key, Generate generate) {
+        Pattern p;
+        if (cache.find(key, p)) return p;
+
+        savedRng = rng;
+        rng.seed(key.hash());
+        p = generate(static_cast<float>(key.densityStep) / DENSITY_STEPS);
+        rng = savedRng;
+
+        cache.insert(key, p);
+        return p;
+    }
+
     const float* getWeightsForRole(Role role, const StyleProfile& style) {
         switch (role) {
             case TIMELINE:   return style.timeline;
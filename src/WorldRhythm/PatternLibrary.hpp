@@ -471,14 +471,16 @@ public:
                          float intensity, int rotation) {
         Pattern p = generatePattern(type, targetLength, intensity);
 
-        // Create rotated pattern
+        // Create rotated pattern: the masks rotate, velocities follow
         Pattern rotated(targetLength);
-        for (int i = 0; i < targetLength; i++) {
-            int srcPos = (i - rotation + targetLength) % targetLength;
-            if (p.hasOnsetAt(srcPos)) {
-                rotated.setOnset(i, p.getVelocity(srcPos));
-                rotated.accents[i] = p.accents[srcPos];
-            }
+        int length = rotated.length;
+        PatternBits bits = PatternBits(p).rotated(rotation);
+        int shift = ((rotation % length) + length) % length;
+        for (uint32_t m = bits.onsets; m; m &= m - 1) {
+            int i = lowestStep(m);
+            int srcPos = (i - shift + length) % length;
+            rotated.setOnset(i, p.getVelocity(srcPos));
+            rotated.accents[i] = (bits.accents >> i) & 1u;
         }
 
         return rotated;
@@ -3,6 +3,7 @@
 #include <vector>
 #include <random>
 #include <cmath>
+#include <limits>
 #include "PatternGenerator.hpp"
 #include "StyleProfiles.hpp"
 
@@ -24,6 +25,33 @@ struct RestProfile {
     float clusterProbability;   // Probability of consecutive rests
 };
 
+// ========================================
+// Precomputed rest order
+// ========================================
+// threshold[i] is the REST amount above which step i falls silent. The
+// random draws are made once when the pattern is generated, so applying
+// any REST amount is a compare per step, turning REST up only ever adds
+// rests, and sweeping it back restores the same notes.
+struct RestRanks {
+    static constexpr float NEVER = std::numeric_limits<float>::infinity();
+
+    float threshold[MAX_PATTERN_LENGTH];
+    int length = 0;
+
+    RestRanks() {
+        for (int i = 0; i < MAX_PATTERN_LENGTH; i++) threshold[i] = NEVER;
+    }
+
+    // Bit i set when step i rests at this amount
+    uint32_t restMask(float restAmount) const {
+        uint32_t mask = 0;
+        for (int i = 0; i < length; i++) {
+            if (restAmount > threshold[i]) mask |= 1u << i;
+        }
+        return mask;
+    }
+};
+
 // ========================================
 // Style-Specific Rest Profiles
 // ========================================
@@ -199,11 +227,16 @@ public:
                              float restAmount, bool isAccented) const {
         const RestProfile& profile = profiles[currentProfileIndex];
 
-        // Base probability from user control
-        float prob = restAmount;
+        // Base probability from user control, position and accent modifiers,
+        // clamped to the role maximum
+        float prob = restAmount * getRestMultiplier(position, patternLength, isAccented);
+        return std::min(prob, profile.roleMaxRest[role]);
+    }
 
-        // Apply role maximum
-        float roleMax = profile.roleMaxRest[role];
+    // Position and accent modifiers applied to the REST amount
+    float getRestMultiplier(int position, int patternLength, bool isAccented) const {
+        const RestProfile& profile = profiles[currentProfileIndex];
+        float multiplier = 1.0f;
 
         // Strong beat detection (positions 0, 4, 8, 12 in 16-grid)
         int pos16 = (position * 16) / patternLength;
@@ -212,53 +245,85 @@ public:
 
         // Apply position modifiers
         if (isStrongBeat) {
-            prob *= profile.strongBeatProtection;
+            multiplier *= profile.strongBeatProtection;
         }
         if (isWeakSubdivision) {
-            prob *= profile.weakBeatBoost;
+            multiplier *= profile.weakBeatBoost;
         }
 
         // Apply accent protection
         if (isAccented) {
-            prob *= profile.accentProtection;
+            multiplier *= profile.accentProtection;
         }
 
-        // Clamp to role maximum
-        return std::min(prob, roleMax);
+        return multiplier;
     }
 
     // ========================================
-    // Apply rest to pattern with clustering
+    // Rank a pattern for rest with clustering
     // ========================================
-    void applyRest(Pattern& p, Role role, float restAmount) {
-        if (restAmount <= 0.0f) return;
-
+    // One draw per onset, in step order. Step i rests at amount r when
+    //   u < min(r * multiplier + clusterBoost(r), roleMax)
+    // where the cluster boost applies once the previous onset rests and
+    // r > 0.3 (x1.5 above 0.6). Both sides only grow with r, so each step
+    // has a single threshold, found per interval between the breakpoints.
+    RestRanks rankRest(const Pattern& p, Role role) {
         const RestProfile& profile = profiles[currentProfileIndex];
         std::uniform_real_distribution<float> dist(0.0f, 1.0f);
 
-        bool previousWasRest = false;
+        RestRanks ranks;
+        ranks.length = p.length;
+        float previous = RestRanks::NEVER;  // threshold of the previous onset
 
         for (int i = 0; i < p.length; i++) {
             if (!p.hasOnsetAt(i)) continue;
 
-            // Calculate base probability
-            float prob = getRestProbability(i, p.length, role, restAmount, p.accents[i]);
-
-            // Apply clustering
-            if (previousWasRest && restAmount > 0.3f) {
-                float clusterBoost = profile.clusterProbability *
-                                    (restAmount > 0.6f ? 1.5f : 1.0f);
-                prob = std::min(prob + clusterBoost, profile.roleMaxRest[role]);
+            float u = dist(rng);
+            float multiplier = getRestMultiplier(i, p.length, p.accents[i]);
+            float threshold = RestRanks::NEVER;
+
+            if (u < profile.roleMaxRest[role]) {
+                float edges[5] = {0.0f, 0.3f, 0.6f, previous, RestRanks::NEVER};
+                std::sort(edges, edges + 5);
+                for (int k = 0; k < 4; k++) {
+                    float lo = edges[k];
+                    float hi = edges[k + 1];
+                    if (!(lo < hi)) continue;
+                    // Boost is constant on (lo, hi], so evaluate it at hi
+                    bool clustered = hi > previous && hi > 0.3f;
+                    float boost = clustered ? profile.clusterProbability * (hi > 0.6f ? 1.5f : 1.0f) : 0.0f;
+                    float start = std::max(lo, (u - boost) / multiplier);
+                    if (start < hi) {
+                        threshold = start;
+                        break;
+                    }
+                }
             }
 
-            // Decide if rest
-            if (dist(rng) < prob) {
-                p.clearOnset(i);
-                previousWasRest = true;
-            } else {
-                previousWasRest = false;
-            }
+            ranks.threshold[i] = threshold;
+            previous = threshold;
         }
+        return ranks;
+    }
+
+    // Silence the steps in `rests`
+    static void clearRests(Pattern& p, uint32_t rests) {
+        for (uint32_t m = rests & p.onsetMask(); m; m &= m - 1) {
+            p.clearOnset(lowestStep(m));
+        }
+    }
+
+    // Threshold precomputed ranks, no random draws
+    static void applyRest(Pattern& p, const RestRanks& ranks, float restAmount) {
+        clearRests(p, ranks.restMask(restAmount));
+    }
+
+    // ========================================
+    // Apply rest to pattern with clustering
+    // ========================================
+    void applyRest(Pattern& p, Role role, float restAmount) {
+        if (restAmount <= 0.0f) return;
+        applyRest(p, rankRest(p, role), restAmount);
     }
 
     // ========================================
@@ -491,39 +556,43 @@ public:
     // Density-Aware Rest (v0.14)
     // Applies more rest to denser areas, less to sparse areas
     // ========================================
-    void applyDensityAwareRest(Pattern& p, Role role, float restAmount) {
-        if (restAmount <= 0.0f) return;
-
+    RestRanks rankDensityAwareRest(const Pattern& p, Role role) {
         const RestProfile& profile = profiles[currentProfileIndex];
         std::uniform_real_distribution<float> dist(0.0f, 1.0f);
 
         // Calculate local density for each position
         int windowSize = 4;
-        std::vector<float> localDensity(p.length, 0.0f);
+        float localDensity[MAX_PATTERN_LENGTH] = {};
 
         for (int i = 0; i < p.length; i++) {
             int count = 0;
             for (int j = -windowSize; j <= windowSize; j++) {
-                int idx = (i + j + p.length) % p.length;
+                int idx = ((i + j) % p.length + p.length) % p.length;
                 if (p.hasOnsetAt(idx)) count++;
             }
             localDensity[i] = static_cast<float>(count) / (windowSize * 2 + 1);
         }
 
-        // Apply rest based on local density
+        // Rest when u < min(min(r * multiplier, roleMax) * densityMultiplier, roleMax)
+        RestRanks ranks;
+        ranks.length = p.length;
         for (int i = 0; i < p.length; i++) {
             if (!p.hasOnsetAt(i)) continue;
 
             // Higher density = more likely to rest
             float densityMultiplier = 0.5f + localDensity[i];
-            float prob = getRestProbability(i, p.length, role, restAmount, p.accents[i]);
-            prob *= densityMultiplier;
-            prob = std::min(prob, profile.roleMaxRest[role]);
-
-            if (dist(rng) < prob) {
-                p.clearOnset(i);
+            float u = dist(rng);
+            float reachable = profile.roleMaxRest[role] * std::min(densityMultiplier, 1.0f);
+            if (u < reachable) {
+                ranks.threshold[i] = u / (getRestMultiplier(i, p.length, p.accents[i]) * densityMultiplier);
             }
         }
+        return ranks;
+    }
+
+    void applyDensityAwareRest(Pattern& p, Role role, float restAmount) {
+        if (restAmount <= 0.0f) return;
+        applyRest(p, rankDensityAwareRest(p, role), restAmount);
     }
 
     // ========================================
@@ -1,5 +1,11 @@
 #pragma once
 
+#include "MinimalDrumSynth.hpp"
+
+// Style, groove and drum preset tables shared by every WorldRhythm module.
+// All of them are constexpr: they live in read-only data, exist once in the
+// binary and cost nothing at load time.
+
 namespace WorldRhythm {
 
 // ========================================
@@ -47,7 +53,7 @@ struct StyleProfile {
 // Hemiola 3:2: 3-feel every 4 pulse (1,5,9,13), 2-feel every 6 pulse (1,7,13)
 // Swing: 0.62 (between straight and triplet, 60-65% range)
 
-const StyleProfile WEST_AFRICAN = {
+inline constexpr StyleProfile WEST_AFRICAN = {
     "West African",
     0.62f,
 
@@ -91,7 +97,7 @@ const StyleProfile WEST_AFRICAN = {
 // Tumbao ponche MUST align to clave positions
 // Swing: 0.58 (55-65% range)
 
-const StyleProfile AFRO_CUBAN = {
+inline constexpr StyleProfile AFRO_CUBAN = {
     "Afro-Cuban",
     0.58f,
 
@@ -134,7 +140,7 @@ const StyleProfile AFRO_CUBAN = {
 // Batucada weave: multi-layer interlock between Caixa/Tamborim
 // Swing: 0.57 (55-60% range)
 
-const StyleProfile BRAZILIAN = {
+inline constexpr StyleProfile BRAZILIAN = {
     "Brazilian",
     0.57f,
 
@@ -178,7 +184,7 @@ const StyleProfile BRAZILIAN = {
 // Downbeats: 1, 5, 10 (start of each group)
 // Swing: 0.50 (straight, asymmetry is in grouping)
 
-const StyleProfile BALKAN = {
+inline constexpr StyleProfile BALKAN = {
     "Balkan",
     0.50f,
 
@@ -223,7 +229,7 @@ const StyleProfile BALKAN = {
 // Dhin positions: 2, 3, 6, 7, 10, 11, 14, 15 (lighter, clear)
 // Swing: 0.50 (straight)
 
-const StyleProfile INDIAN = {
+inline constexpr StyleProfile INDIAN = {
     "Indian",
     0.50f,
 
@@ -264,7 +270,7 @@ const StyleProfile INDIAN = {
 // Kotekan interlocking between voices
 // Swing: 0.50 (straight)
 
-const StyleProfile GAMELAN = {
+inline constexpr StyleProfile GAMELAN = {
     "Gamelan",
     0.50f,
 
@@ -305,7 +311,7 @@ const StyleProfile GAMELAN = {
 // Snare comping responds to ride
 // Swing: 0.65 (strong swing, 65-70% range)
 
-const StyleProfile JAZZ = {
+inline constexpr StyleProfile JAZZ = {
     "Jazz",
     0.65f,
 
@@ -348,7 +354,7 @@ const StyleProfile JAZZ = {
 // Snare/clap on 2 and 4
 // Swing: 0.50 (straight)
 
-const StyleProfile ELECTRONIC = {
+inline constexpr StyleProfile ELECTRONIC = {
     "Electronic",
     0.50f,
 
@@ -387,7 +393,7 @@ const StyleProfile ELECTRONIC = {
 // DnB 2-step kick: 1, 1a, 3& (positions 1, 4, 11 in 16-grid)
 // Swing: 0.52 (nearly straight with slight push)
 
-const StyleProfile BREAKBEAT = {
+inline constexpr StyleProfile BREAKBEAT = {
     "Breakbeat",
     0.52f,
 
@@ -431,7 +437,7 @@ const StyleProfile BREAKBEAT = {
 // Lead: Sparse industrial perc (15-30%, NOT 0%)
 // Swing: 0.50 (perfectly straight, 0ms humanization)
 
-const StyleProfile TECHNO = {
+inline constexpr StyleProfile TECHNO = {
     "Techno",
     0.50f,
 
@@ -469,7 +475,7 @@ const StyleProfile TECHNO = {
 // Style Array
 // ============================================================
 
-const StyleProfile* const STYLES[] = {
+inline constexpr const StyleProfile* STYLES[] = {
     &WEST_AFRICAN,
     &AFRO_CUBAN,
     &BRAZILIAN,
@@ -482,6 +488,189 @@ const StyleProfile* const STYLES[] = {
     &TECHNO
 };
 
-const int NUM_STYLES = 10;
+inline constexpr int NUM_STYLES = 10;
+
+// ============================================================
+// Groove Templates
+// ============================================================
+// Each position has a systematic timing offset that defines the "feel"
+struct GrooveTemplate {
+    const char* name;
+    float offsets[16];      // Timing offsets in ms for each 16th note position
+    float velMods[16];      // Velocity modifiers (multiplier)
+};
+
+inline constexpr int NUM_GROOVE_TEMPLATES = 6;
+
+inline constexpr GrooveTemplate GROOVE_TEMPLATES[NUM_GROOVE_TEMPLATES] = {
+    // Straight: machine-like but with subtle humanization
+    {"Straight",
+     {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+      0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+     {1.0f, 0.8f, 0.9f, 0.8f, 1.0f, 0.8f, 0.9f, 0.8f,
+      1.0f, 0.8f, 0.9f, 0.8f, 1.0f, 0.8f, 0.9f, 0.8f}},
+
+    // Swing: upbeats pushed late, beat 3 slightly early
+    {"Swing",
+     {0.0f, 8.0f, 0.0f, 10.0f, 0.0f, 7.0f, 0.0f, 9.0f,
+      -2.0f, 8.0f, 0.0f, 10.0f, 0.0f, 7.0f, 0.0f, 9.0f},
+     {1.0f, 0.85f, 0.9f, 0.8f, 0.95f, 0.85f, 0.9f, 0.8f,
+      1.0f, 0.85f, 0.9f, 0.8f, 0.95f, 0.85f, 0.9f, 0.8f}},
+
+    // West African: specific positions pushed/pulled for polyrhythmic feel
+    {"African",
+     {0.0f, -3.0f, 2.0f, -2.0f, 0.0f, 3.0f, -1.0f, 2.0f,
+      0.0f, -3.0f, 1.0f, 0.0f, 2.0f, -2.0f, 0.0f, 3.0f},
+     {1.0f, 0.7f, 0.85f, 0.9f, 0.8f, 0.75f, 0.95f, 0.7f,
+      0.85f, 0.7f, 0.9f, 0.75f, 1.0f, 0.7f, 0.8f, 0.75f}},
+
+    // Afro-Cuban: clave-based feel
+    {"Latin",
+     {0.0f, 4.0f, 0.0f, -2.0f, 0.0f, 5.0f, -1.0f, 3.0f,
+      0.0f, 4.0f, -2.0f, 3.0f, 0.0f, 5.0f, 0.0f, 4.0f},
+     {1.0f, 0.7f, 0.8f, 0.95f, 0.75f, 0.7f, 0.9f, 0.7f,
+      0.8f, 0.7f, 0.95f, 0.7f, 0.9f, 0.7f, 0.75f, 0.7f}},
+
+    // Laid back: everything slightly behind the beat
+    {"Laid Back",
+     {4.0f, 6.0f, 4.0f, 6.0f, 4.0f, 6.0f, 4.0f, 6.0f,
+      4.0f, 6.0f, 4.0f, 6.0f, 4.0f, 6.0f, 4.0f, 6.0f},
+     {1.0f, 0.85f, 0.85f, 0.85f, 1.0f, 0.85f, 0.85f, 0.85f,
+      1.0f, 0.85f, 0.85f, 0.85f, 1.0f, 0.85f, 0.85f, 0.85f}},
+
+    // Pushed: everything slightly ahead
+    {"Pushed",
+     {-3.0f, -4.5f, -3.0f, -4.5f, -3.0f, -4.5f, -3.0f, -4.5f,
+      -3.0f, -4.5f, -3.0f, -4.5f, -3.0f, -4.5f, -3.0f, -4.5f},
+     {1.0f, 0.9f, 0.9f, 0.9f, 1.0f, 0.9f, 0.9f, 0.9f,
+      1.0f, 0.9f, 0.9f, 0.9f, 1.0f, 0.9f, 0.9f, 0.9f}}
+};
+
+// ============================================================
+// 8-voice Drum Style Presets
+// ============================================================
+// Shared by UniversalRhythm, UniRhythm and Drummmmmmer. Sweep and bend are
+// only used by synths that support them. The voices themselves live in
+// MinimalDrumSynth.hpp (namespace worldrhythm).
+using SynthMode = worldrhythm::SynthMode;
+
+struct DrumStylePreset {
+    struct VoicePreset {
+        SynthMode mode;
+        float freq;
+        float decay;
+        const char* name;
+        float sweep = 0.f;
+        float bend = 1.f;
+    };
+    VoicePreset voices[8];
+};
+
+inline constexpr int NUM_DRUM_STYLE_PRESETS = 10;
+
+// Voice assignments per style (2 voices per role):
+// 0-1: Timeline, 2-3: Foundation, 4-5: Groove, 6-7: Lead
+
+inline constexpr DrumStylePreset DRUM_STYLE_PRESETS[NUM_DRUM_STYLE_PRESETS] = {
+    // 0: West African
+    {{{SynthMode::SINE, 4500.0f, 60.0f, "Gankogui"},
+      {SynthMode::SINE, 3500.0f, 40.0f, "Bell Lo"},
+      {SynthMode::SINE, 80.0f, 200.0f, "Dununba"},
+      {SynthMode::SINE, 120.0f, 150.0f, "Dunun"},
+      {SynthMode::SINE, 250.0f, 80.0f, "Sangban"},
+      {SynthMode::SINE, 300.0f, 60.0f, "Kenkeni"},
+      {SynthMode::NOISE, 700.0f, 40.0f, "Djembe Slap"},
+      {SynthMode::NOISE, 400.0f, 50.0f, "Djembe Tone"}}},
+
+    // 1: Afro-Cuban
+    {{{SynthMode::SINE, 4000.0f, 20.0f, "Clave"},
+      {SynthMode::SINE, 2000.0f, 30.0f, "Cowbell"},
+      {SynthMode::SINE, 100.0f, 150.0f, "Tumba"},
+      {SynthMode::SINE, 150.0f, 120.0f, "Conga Lo"},
+      {SynthMode::SINE, 350.0f, 70.0f, "Conga Mid"},
+      {SynthMode::SINE, 550.0f, 50.0f, "Quinto"},
+      {SynthMode::NOISE, 3000.0f, 40.0f, "Timbales"},
+      {SynthMode::NOISE, 5000.0f, 25.0f, "Quinto Slap"}}},
+
+    // 2: Brazilian
+    {{{SynthMode::SINE, 4500.0f, 35.0f, "Agogo Hi"},
+      {SynthMode::SINE, 3000.0f, 35.0f, "Agogo Lo"},
+      {SynthMode::SINE, 55.0f, 250.0f, "Surdo"},
+      {SynthMode::SINE, 80.0f, 180.0f, "Surdo 2"},
+      {SynthMode::SINE, 400.0f, 40.0f, "Tamborim"},
+      {SynthMode::NOISE, 500.0f, 50.0f, "Caixa"},
+      {SynthMode::NOISE, 6000.0f, 30.0f, "Ganza"},
+      {SynthMode::NOISE, 8000.0f, 20.0f, "Chocalho"}}},
+
+    // 3: Balkan
+    {{{SynthMode::NOISE, 4000.0f, 25.0f, "Rim"},
+      {SynthMode::NOISE, 3500.0f, 15.0f, "Click"},
+      {SynthMode::SINE, 90.0f, 180.0f, "Tapan Bass"},
+      {SynthMode::SINE, 130.0f, 120.0f, "Tapan Mid"},
+      {SynthMode::SINE, 300.0f, 50.0f, "Tarabuka Doum"},
+      {SynthMode::SINE, 450.0f, 35.0f, "Tarabuka Tek"},
+      {SynthMode::NOISE, 3000.0f, 25.0f, "Tek Hi"},
+      {SynthMode::NOISE, 5000.0f, 20.0f, "Ka"}}},
+
+    // 4: Indian
+    {{{SynthMode::NOISE, 8000.0f, 150.0f, "Manjira"},
+      {SynthMode::NOISE, 6000.0f, 100.0f, "Ghungroo"},
+      {SynthMode::SINE, 65.0f, 300.0f, "Baya Ge"},
+      {SynthMode::SINE, 90.0f, 200.0f, "Baya Ka"},
+      {SynthMode::SINE, 350.0f, 100.0f, "Daya Na"},
+      {SynthMode::SINE, 500.0f, 80.0f, "Daya Tin"},
+      {SynthMode::NOISE, 1500.0f, 60.0f, "Daya Ti"},
+      {SynthMode::NOISE, 2500.0f, 40.0f, "Daya Re"}}},
+
+    // 5: Gamelan
+    {{{SynthMode::SINE, 700.0f, 400.0f, "Kenong"},
+      {SynthMode::SINE, 600.0f, 350.0f, "Kethuk"},
+      {SynthMode::SINE, 90.0f, 800.0f, "Gong"},
+      {SynthMode::SINE, 150.0f, 500.0f, "Kempul"},
+      {SynthMode::SINE, 800.0f, 200.0f, "Bonang Po"},
+      {SynthMode::SINE, 1000.0f, 180.0f, "Bonang Sa"},
+      {SynthMode::SINE, 1200.0f, 250.0f, "Gender"},
+      {SynthMode::SINE, 1400.0f, 220.0f, "Saron"}}},
+
+    // 6: Jazz
+    {{{SynthMode::NOISE, 4500.0f, 120.0f, "Ride"},
+      {SynthMode::NOISE, 2500.0f, 80.0f, "Ride Bell"},
+      {SynthMode::SINE, 50.0f, 200.0f, "Kick"},
+      {SynthMode::SINE, 80.0f, 150.0f, "Kick Ghost"},
+      {SynthMode::NOISE, 500.0f, 100.0f, "Snare"},
+      {SynthMode::NOISE, 400.0f, 60.0f, "Snare Ghost"},
+      {SynthMode::NOISE, 8000.0f, 35.0f, "HiHat Cl"},
+      {SynthMode::NOISE, 6000.0f, 150.0f, "HiHat Op"}}},
+
+    // 7: Electronic
+    {{{SynthMode::NOISE, 9000.0f, 30.0f, "HiHat"},
+      {SynthMode::NOISE, 12000.0f, 20.0f, "HiHat Ac"},
+      {SynthMode::SINE, 45.0f, 280.0f, "808 Kick", 120.f, 0.8f},
+      {SynthMode::SINE, 60.0f, 200.0f, "Kick 2", 80.f, 1.0f},
+      {SynthMode::NOISE, 1500.0f, 70.0f, "Clap"},
+      {SynthMode::NOISE, 2500.0f, 50.0f, "Snare"},
+      {SynthMode::NOISE, 6000.0f, 150.0f, "Open HH"},
+      {SynthMode::SINE, 800.0f, 100.0f, "Perc"}}},
+
+    // 8: Breakbeat
+    {{{SynthMode::NOISE, 8000.0f, 25.0f, "HiHat"},
+      {SynthMode::NOISE, 10000.0f, 15.0f, "HiHat Ac"},
+      {SynthMode::SINE, 55.0f, 180.0f, "Kick", 140.f, 1.0f},
+      {SynthMode::SINE, 70.0f, 120.0f, "Kick Gho", 60.f, 1.2f},
+      {SynthMode::NOISE, 2500.0f, 80.0f, "Snare"},
+      {SynthMode::NOISE, 2000.0f, 50.0f, "Snare Gh"},
+      {SynthMode::NOISE, 4000.0f, 40.0f, "Ghost"},
+      {SynthMode::NOISE, 6000.0f, 100.0f, "Open HH"}}},
+
+    // 9: Techno
+    {{{SynthMode::NOISE, 10000.0f, 20.0f, "HiHat"},
+      {SynthMode::NOISE, 12000.0f, 12.0f, "HiHat Ac"},
+      {SynthMode::SINE, 42.0f, 250.0f, "909 Kick", 160.f, 1.2f},
+      {SynthMode::SINE, 55.0f, 180.0f, "Kick Lay", 100.f, 1.0f},
+      {SynthMode::NOISE, 1800.0f, 55.0f, "Clap"},
+      {SynthMode::NOISE, 3000.0f, 35.0f, "Rim"},
+      {SynthMode::NOISE, 5000.0f, 80.0f, "Open HH"},
+      {SynthMode::SINE, 600.0f, 60.0f, "Tom"}}}
+};
 
 } // namespace WorldRhythm
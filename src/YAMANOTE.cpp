@@ -1,4 +1,5 @@
 #include "plugin.hpp"
+#include "PolyBus.hpp"
 
 struct YAMANOTE : Module {
     enum ParamId {
@@ -60,6 +61,10 @@ struct YAMANOTE : Module {
 
     static constexpr int MAX_POLY = 16;
 
+    // Sum the mixers to the left over the expander bus instead of the chain cables
+    bool expanderBus = false;
+    polybus::BusFrame busFrames[2];
+
     YAMANOTE() {
         config(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
         
@@ -84,29 +89,53 @@ struct YAMANOTE : Module {
         configOutput(SEND_B_R_OUTPUT, "Send B Right");
         configOutput(MIX_L_OUTPUT, "Mix Left");
         configOutput(MIX_R_OUTPUT, "Mix Right");
+
+        polybus::attachBus(this, busFrames);
     }
 
     void process(const ProcessArgs& args) override {
-        // Determine maximum polyphonic channels across all inputs
+        using simd::float_4;
+
+        // Cache connection state, channel counts and send levels once per block
+        polybus::PortState leftState[8], rightState[8];
+        float sendALevel[8], sendBLevel[8];
+        int activeInputs[8];
+        int activeCount = 0;
         int maxChannels = 1;
 
-        // Check channel inputs
         for (int i = 0; i < 8; ++i) {
-            int leftChannels = inputs[CH1_L_INPUT + i * 2].getChannels();
-            int rightChannels = inputs[CH1_R_INPUT + i * 2].getChannels();
-            maxChannels = std::max({maxChannels, leftChannels, rightChannels});
+            leftState[i].read(inputs[CH1_L_INPUT + i * 2]);
+            rightState[i].read(inputs[CH1_R_INPUT + i * 2]);
+            maxChannels = std::max({maxChannels, leftState[i].channels, rightState[i].channels});
+
+            if (leftState[i].connected || rightState[i].connected) {
+                sendALevel[i] = params[CH1_SEND_A_PARAM + i * 2].getValue();
+                sendBLevel[i] = params[CH1_SEND_B_PARAM + i * 2].getValue();
+                activeInputs[activeCount++] = i;
+            }
         }
 
-        // Check return and chain inputs
+        polybus::PortState chainL, chainR, returnAL, returnAR, returnBL, returnBR;
+        chainL.read(inputs[CHAIN_L_INPUT]);
+        chainR.read(inputs[CHAIN_R_INPUT]);
+        returnAL.read(inputs[RETURN_A_L_INPUT]);
+        returnAR.read(inputs[RETURN_A_R_INPUT]);
+        returnBL.read(inputs[RETURN_B_L_INPUT]);
+        returnBR.read(inputs[RETURN_B_R_INPUT]);
         maxChannels = std::max({maxChannels,
-            inputs[CHAIN_L_INPUT].getChannels(),
-            inputs[CHAIN_R_INPUT].getChannels(),
-            inputs[RETURN_A_L_INPUT].getChannels(),
-            inputs[RETURN_A_R_INPUT].getChannels(),
-            inputs[RETURN_B_L_INPUT].getChannels(),
-            inputs[RETURN_B_R_INPUT].getChannels()
+            chainL.channels, chainR.channels,
+            returnAL.channels, returnAR.channels,
+            returnBL.channels, returnBR.channels
         });
 
+        // The left neighbour's output joins with the chain inputs.
+        // Cable chaining takes over whenever a chain input is patched.
+        bool joinsBus = expanderBus && !chainL.connected && !chainR.connected;
+        const polybus::BusFrame* bus = joinsBus ? polybus::busInput(this) : nullptr;
+        int busChannels = bus ? bus->channels : 0;
+        maxChannels = std::max(maxChannels, busChannels);
+        polybus::BusFrame* busFrame = polybus::busOutput(this);
+
         // Set output channels
         outputs[SEND_A_L_OUTPUT].setChannels(maxChannels);
         outputs[SEND_A_R_OUTPUT].setChannels(maxChannels);
@@ -115,113 +144,116 @@ struct YAMANOTE : Module {
         outputs[MIX_L_OUTPUT].setChannels(maxChannels);
         outputs[MIX_R_OUTPUT].setChannels(maxChannels);
 
-        // Process each polyphonic channel
-        for (int c = 0; c < maxChannels; c++) {
-            float sendAL = 0.0f, sendAR = 0.0f;
-            float sendBL = 0.0f, sendBR = 0.0f;
-            float mixL = 0.0f, mixR = 0.0f;
-
-            // Process each input channel
-            for (int i = 0; i < 8; ++i) {
-                int leftChannels = inputs[CH1_L_INPUT + i * 2].getChannels();
-                int rightChannels = inputs[CH1_R_INPUT + i * 2].getChannels();
+        // Four polyphonic channels per pass
+        for (int c = 0; c < maxChannels; c += 4) {
+            float_4 sendAL = 0.f, sendAR = 0.f;
+            float_4 sendBL = 0.f, sendBR = 0.f;
 
-                float inputL = 0.0f, inputR = 0.0f;
-
-                // Get input voltages (use channel 0 if current channel doesn't exist)
-                if (inputs[CH1_L_INPUT + i * 2].isConnected()) {
-                    int useChan = (c < leftChannels) ? c : 0;
-                    inputL = inputs[CH1_L_INPUT + i * 2].getPolyVoltage(useChan);
-                }
+            for (int n = 0; n < activeCount; ++n) {
+                int i = activeInputs[n];
 
-                if (inputs[CH1_R_INPUT + i * 2].isConnected()) {
-                    int useChan = (c < rightChannels) ? c : 0;
-                    inputR = inputs[CH1_R_INPUT + i * 2].getPolyVoltage(useChan);
-                } else if (inputs[CH1_L_INPUT + i * 2].isConnected()) {
+                // Missing channels fall back to channel 0
+                float_4 inputL = polybus::loadOrFirst(inputs[CH1_L_INPUT + i * 2], leftState[i], c);
+                float_4 inputR;
+                if (rightState[i].connected) {
+                    inputR = polybus::loadOrFirst(inputs[CH1_R_INPUT + i * 2], rightState[i], c);
+                } else {
                     // If only left is connected, use it for right as well
                     inputR = inputL;
                 }
 
-                float sendALevel = params[CH1_SEND_A_PARAM + i * 2].getValue();
-                float sendBLevel = params[CH1_SEND_B_PARAM + i * 2].getValue();
-
-                sendAL += inputL * sendALevel;
-                sendAR += inputR * sendALevel;
-                sendBL += inputL * sendBLevel;
-                sendBR += inputR * sendBLevel;
-            }
-
-            // Set send outputs
-            outputs[SEND_A_L_OUTPUT].setVoltage(sendAL, c);
-            outputs[SEND_A_R_OUTPUT].setVoltage(sendAR, c);
-            outputs[SEND_B_L_OUTPUT].setVoltage(sendBL, c);
-            outputs[SEND_B_R_OUTPUT].setVoltage(sendBR, c);
-
-            // Process returns and chain
-            float returnAL = 0.0f, returnAR = 0.0f;
-            float returnBL = 0.0f, returnBR = 0.0f;
-            float chainL = 0.0f, chainR = 0.0f;
-
-            if (inputs[RETURN_A_L_INPUT].isConnected()) {
-                int chanCount = inputs[RETURN_A_L_INPUT].getChannels();
-                int useChan = (c < chanCount) ? c : 0;
-                returnAL = inputs[RETURN_A_L_INPUT].getPolyVoltage(useChan);
-            }
-
-            if (inputs[RETURN_A_R_INPUT].isConnected()) {
-                int chanCount = inputs[RETURN_A_R_INPUT].getChannels();
-                int useChan = (c < chanCount) ? c : 0;
-                returnAR = inputs[RETURN_A_R_INPUT].getPolyVoltage(useChan);
-            }
-
-            if (inputs[RETURN_B_L_INPUT].isConnected()) {
-                int chanCount = inputs[RETURN_B_L_INPUT].getChannels();
-                int useChan = (c < chanCount) ? c : 0;
-                returnBL = inputs[RETURN_B_L_INPUT].getPolyVoltage(useChan);
+                sendAL += inputL * sendALevel[i];
+                sendAR += inputR * sendALevel[i];
+                sendBL += inputL * sendBLevel[i];
+                sendBR += inputR * sendBLevel[i];
             }
 
-            if (inputs[RETURN_B_R_INPUT].isConnected()) {
-                int chanCount = inputs[RETURN_B_R_INPUT].getChannels();
-                int useChan = (c < chanCount) ? c : 0;
-                returnBR = inputs[RETURN_B_R_INPUT].getPolyVoltage(useChan);
+            outputs[SEND_A_L_OUTPUT].setVoltageSimd(sendAL, c);
+            outputs[SEND_A_R_OUTPUT].setVoltageSimd(sendAR, c);
+            outputs[SEND_B_L_OUTPUT].setVoltageSimd(sendBL, c);
+            outputs[SEND_B_R_OUTPUT].setVoltageSimd(sendBR, c);
+
+            // Mix returns and chain
+            float_4 mixL = polybus::loadOrFirst(inputs[RETURN_A_L_INPUT], returnAL, c)
+                         + polybus::loadOrFirst(inputs[RETURN_B_L_INPUT], returnBL, c)
+                         + polybus::loadOrFirst(inputs[CHAIN_L_INPUT], chainL, c);
+            float_4 mixR = polybus::loadOrFirst(inputs[RETURN_A_R_INPUT], returnAR, c)
+                         + polybus::loadOrFirst(inputs[RETURN_B_R_INPUT], returnBR, c)
+                         + polybus::loadOrFirst(inputs[CHAIN_R_INPUT], chainR, c);
+
+            if (bus) {
+                mixL += polybus::busOrFirst(bus->left, busChannels, c);
+                mixR += polybus::busOrFirst(bus->right, busChannels, c);
             }
 
-            if (inputs[CHAIN_L_INPUT].isConnected()) {
-                int chanCount = inputs[CHAIN_L_INPUT].getChannels();
-                int useChan = (c < chanCount) ? c : 0;
-                chainL = inputs[CHAIN_L_INPUT].getPolyVoltage(useChan);
-            }
+            outputs[MIX_L_OUTPUT].setVoltageSimd(mixL, c);
+            outputs[MIX_R_OUTPUT].setVoltageSimd(mixR, c);
 
-            if (inputs[CHAIN_R_INPUT].isConnected()) {
-                int chanCount = inputs[CHAIN_R_INPUT].getChannels();
-                int useChan = (c < chanCount) ? c : 0;
-                chainR = inputs[CHAIN_R_INPUT].getPolyVoltage(useChan);
+            // The right neighbour receives exactly what leaves the mix outputs
+            if (busFrame) {
+                mixL.store(busFrame->left + c);
+                mixR.store(busFrame->right + c);
             }
+        }
 
-            // Mix outputs
-            mixL = returnAL + returnBL + chainL;
-            mixR = returnAR + returnBR + chainR;
-
-            outputs[MIX_L_OUTPUT].setVoltage(mixL, c);
-            outputs[MIX_R_OUTPUT].setVoltage(mixR, c);
+        if (busFrame) {
+            polybus::publishBus(this, busFrame, maxChannels);
         }
     }
 
     void processBypass(const ProcessArgs& args) override {
         int chainLeftChannels = inputs[CHAIN_L_INPUT].getChannels();
         int chainRightChannels = inputs[CHAIN_R_INPUT].getChannels();
+
+        // Bypassed mixers relay their chain, from the cables or the bus
+        const polybus::BusFrame* bus = nullptr;
+        if (expanderBus && chainLeftChannels == 0 && chainRightChannels == 0) {
+            bus = polybus::busInput(this);
+            if (bus) {
+                chainLeftChannels = bus->channels;
+                chainRightChannels = bus->channels;
+            }
+        }
         int maxChannels = std::max(chainLeftChannels, chainRightChannels);
 
         outputs[MIX_L_OUTPUT].setChannels(maxChannels);
         outputs[MIX_R_OUTPUT].setChannels(maxChannels);
 
+        polybus::BusFrame* busFrame = polybus::busOutput(this);
         for (int c = 0; c < maxChannels; c++) {
-            float chainL = (c < chainLeftChannels) ? inputs[CHAIN_L_INPUT].getPolyVoltage(c) : 0.0f;
-            float chainR = (c < chainRightChannels) ? inputs[CHAIN_R_INPUT].getPolyVoltage(c) : 0.0f;
+            float chainL, chainR;
+            if (bus) {
+                chainL = bus->left[c];
+                chainR = bus->right[c];
+            } else {
+                chainL = (c < chainLeftChannels) ? inputs[CHAIN_L_INPUT].getPolyVoltage(c) : 0.0f;
+                chainR = (c < chainRightChannels) ? inputs[CHAIN_R_INPUT].getPolyVoltage(c) : 0.0f;
+            }
 
             outputs[MIX_L_OUTPUT].setVoltage(chainL, c);
             outputs[MIX_R_OUTPUT].setVoltage(chainR, c);
+
+            if (busFrame) {
+                busFrame->left[c] = chainL;
+                busFrame->right[c] = chainR;
+            }
         }
+
+        if (busFrame) {
+            polybus::publishBus(this, busFrame, maxChannels);
+        }
+    }
+
+    json_t* dataToJson() override {
+        json_t* root = json_object();
+        json_object_set_new(root, "expanderBus", json_boolean(expanderBus));
+        return root;
+    }
+
+    void dataFromJson(json_t* root) override {
+        json_t* expanderBusJ = json_object_get(root, "expanderBus");
+        if (expanderBusJ)
+            expanderBus = json_boolean_value(expanderBusJ);
     }
 };
 
@@ -261,6 +293,14 @@ struct YAMANOTEWidget : ModuleWidget {
         addInput(createInputCentered<PJ301MPort>(Vec(75, 343), module, YAMANOTE::RETURN_B_L_INPUT));
         addInput(createInputCentered<PJ301MPort>(Vec(75, 368), module, YAMANOTE::RETURN_B_R_INPUT));
     }
+
+    void appendContextMenu(ui::Menu* menu) override {
+        YAMANOTE* module = getModule<YAMANOTE>();
+        if (!module) return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createBoolPtrMenuItem("Sum mixers on the left via expander", "", &module->expanderBus));
+    }
 };
 
 Model* modelYAMANOTE = createModel<YAMANOTE, YAMANOTEWidget>("YAMANOTE");
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Accuracy check for FastMath.hpp. Sweeps every approximation, scalar and
+// float_4, against the double-precision std:: reference over the ranges
+// documented in the header and fails if an error exceeds the quoted bound.
+//
+// Not part of the plugin build. From the repository root:
+//   g++ -std=c++17 -O2 -msse4.1 -I$RACK_DIR/include -I$RACK_DIR/dep/include -Isrc \
+//       src/tests/FastMathTest.cpp -o FastMathTest && ./FastMathTest
+#include "FastMath.hpp"
+#include <cstdio>
+
+using rack::simd::float_4;
+
+static int failures = 0;
+
+// Worst error of fast(x) against reference(x) for x in [lo, hi], both paths
+template <typename Fast, typename Reference>
+static void sweep(const char* name, double lo, double hi, double bound, bool relative,
+                  Fast fast, Reference reference) {
+    const int steps = 2000000;
+    double worst = 0.0;
+    double worstX = lo;
+    for (int i = 0; i <= steps; i += 4) {
+        float x[4];
+        for (int lane = 0; lane < 4; lane++)
+            x[lane] = (float)(lo + (hi - lo) * std::min(i + lane, steps) / steps);
+        float_4 vector = fast(float_4(x[0], x[1], x[2], x[3]));
+        for (int lane = 0; lane < 4; lane++) {
+            double expected = reference((double)x[lane]);
+            double scale = relative ? std::fabs(expected) : 1.0;
+            double scalarError = std::fabs(fast(x[lane]) - expected) / scale;
+            double vectorError = std::fabs(vector[lane] - expected) / scale;
+            double error = std::max(scalarError, vectorError);
+            if (error > worst) {
+                worst = error;
+                worstX = x[lane];
+            }
+        }
+    }
+    bool ok = worst <= bound;
+    if (!ok) failures++;
+    std::printf("%-8s [%g, %g]  %s %.2e (bound %.1e) at x = %g  %s\n", name, lo, hi,
+                relative ? "rel" : "abs", worst, bound, worstX, ok ? "ok" : "FAIL");
+}
+
+int main() {
+    sweep("sin2pi", 0.0, 1.0, 1.3e-6, false,
+          [](auto x) { return fastmath::sin2pi(x); },
+          [](double x) { return std::sin(2.0 * M_PI * x); });
+    sweep("cos2pi", 0.0, 1.0, 1.3e-6, false,
+          [](auto x) { return fastmath::cos2pi(x); },
+          [](double x) { return std::cos(2.0 * M_PI * x); });
+    sweep("sin", -40.0, 40.0, 3.5e-6, false,
+          [](auto x) { return fastmath::sin(x); },
+          [](double x) { return std::sin(x); });
+    sweep("cos", -40.0, 40.0, 3.5e-6, false,
+          [](auto x) { return fastmath::cos(x); },
+          [](double x) { return std::cos(x); });
+    sweep("tanh", -20.0, 20.0, 9.6e-5, false,
+          [](auto x) { return fastmath::tanh(x); },
+          [](double x) { return std::tanh(x); });
+    sweep("exp2", -126.0, 126.0, 1.8e-7, true,
+          [](auto x) { return fastmath::exp2(x); },
+          [](double x) { return std::exp2(x); });
+    sweep("exp", -10.0, 10.0, 6.1e-7, true,
+          [](auto x) { return fastmath::exp(x); },
+          [](double x) { return std::exp(x); });
+
+    if (failures) {
+        std::printf("%d approximation(s) outside their documented bound\n", failures);
+        return 1;
+    }
+    std::printf("all approximations within bounds\n");
+    return 0;
+}
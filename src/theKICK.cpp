@@ -1,6 +1,7 @@
 #include "plugin.hpp"
 #include <cmath>
 #include <cstring>
+#include "FastMath.hpp"
 #include "filesystem/async_filebrowser.hh"
 #include "wav/dr_wav.h"
 
@@ -241,7 +242,7 @@ struct theKICK : Module {
         // Pitch envelope: freq = pitch + sweep * exp(-t / (0.015 / bend))
         // Accent boosts sweep depth up to 1.8x for snappier attack
         float pitchTau = 0.015f / state.bend;
-        float pitchEnv = state.sweep * accentSweepMult * std::exp(-pitchEnvTime / pitchTau);
+        float pitchEnv = state.sweep * accentSweepMult * fastmath::exp(-pitchEnvTime / pitchTau);
         float freq = state.pitch + pitchEnv;
 
         // Self-feedback PM
@@ -263,7 +264,7 @@ struct theKICK : Module {
             float frac = tablePos - std::floor(tablePos);
             sampleVal = sampleTable[idx] * (1.f - frac) + sampleTable[next] * frac;
             modDepth = state.sampleFm / 10.f;  // 0~1 normalized
-            sampleEnv = std::exp(-pitchEnvTime / pitchTau);
+            sampleEnv = fastmath::exp(-pitchEnvTime / pitchTau);
 
             // Advance sample playback at oscillator frequency
             samplePlayPos += freq * sampleTime;
@@ -278,12 +279,12 @@ struct theKICK : Module {
         // Mode-dependent oscillator: sample interaction type
         float osc;
         if (useSample) {
-            float carrier = std::sin(2.f * M_PI * phase + fbPhase);
+            float carrier = fastmath::sin(2.f * (float)M_PI * phase + fbPhase);
             switch (modeValue) {
                 case 0: { // PM: phase modulation (classic FM)
                     float fmIndex = modDepth * 4.f * M_PI;  // 0~4pi
                     float samplePhase = fmIndex * sampleVal * sampleEnv;
-                    osc = std::sin(2.f * M_PI * phase + fbPhase + samplePhase);
+                    osc = fastmath::sin(2.f * (float)M_PI * phase + fbPhase + samplePhase);
                     break;
                 }
                 case 1: { // RM: ring modulation
@@ -301,7 +302,7 @@ struct theKICK : Module {
                     if (prevSampleVal * sampleVal < 0.f && depth > 0.01f) {
                         phase *= (1.f - depth);
                     }
-                    osc = std::sin(2.f * M_PI * phase + fbPhase);
+                    osc = fastmath::sin(2.f * (float)M_PI * phase + fbPhase);
                     break;
                 }
                 default:
@@ -310,7 +311,7 @@ struct theKICK : Module {
             }
             prevSampleVal = sampleVal;
         } else {
-            osc = std::sin(2.f * M_PI * phase + fbPhase);
+            osc = fastmath::sin(2.f * (float)M_PI * phase + fbPhase);
         }
 
         // Update feedback state
@@ -332,13 +333,13 @@ struct theKICK : Module {
         // Accent adds +2 dB pre-saturation gain for more harmonic punch
         if (state.fold > 0.01f) {
             float g = (1.f + state.fold * 0.5f) * accentDriveMult;  // 1~6x gain, accent boosts
-            float tanhG = std::tanh(g);
-            filtered = std::tanh(filtered * g) / tanhG;
+            float tanhG = fastmath::tanh(g);
+            filtered = fastmath::tanh(filtered * g) / tanhG;
         }
 
         // Amplitude envelope: simple exponential decay
         float decaySec = state.decayMs * 0.001f;
-        float ampEnv = std::exp(-ampEnvTime / decaySec);
+        float ampEnv = fastmath::exp(-ampEnvTime / decaySec);
 
         // Output
         float output = filtered * ampEnv * 8.f;
@@ -373,7 +374,7 @@ struct theKICK : Module {
         // Apply CV modulation
         if (inputs[PITCH_CV_INPUT].isConnected()) {
             float cv = inputs[PITCH_CV_INPUT].getVoltage();
-            pitch *= std::pow(2.f, cv);
+            pitch *= fastmath::exp2(cv);
             pitchCvMod = clamp(cv / 5.f, -1.f, 1.f);
         } else { pitchCvMod = 0.f; }
 
@@ -427,7 +428,7 @@ struct theKICK : Module {
         } else { toneCvMod = 0.f; }
 
         // Tone knob to frequency: 0=40Hz, 10=20kHz (logarithmic)
-        float toneCutoff = 40.f * std::pow(500.f, toneKnob / 10.f);
+        float toneCutoff = 40.f * fastmath::exp2(toneKnob * 0.89657843f);  // 500^(tone / 10)
 
         // Mode LED: show current mode when sample is loaded
         if (hasSample) {